@@ -0,0 +1,74 @@
+#pragma once
+
+#include "PROPOSAL/Propagator.h"
+
+namespace PROPOSAL {
+/*!
+ * Propagates a bundle of particles of the same type in lock-step.
+ *
+ * Instead of following one particle from start to end, every propagation
+ * step is split into stages (sampling of the next interaction energies,
+ * continuous step including displacement and multiple scattering, stochastic
+ * loss and deflection), and each stage is executed for all active particles
+ * before the next stage begins. Particles are kept in one bucket per sector
+ * and the next interaction energies of a bucket are evaluated with a single
+ * batched call to the PropagationUtility. The continuous step and the
+ * stochastic losses are still calculated particle by particle, and they
+ * dominate the runtime, so the throughput per core is the same as with
+ * Propagator::Propagate within a few percent.
+ *
+ * The physics of every single particle is identical to Propagator::Propagate.
+ * Since the random numbers are drawn interleaved between the particles, the
+ * individual tracks differ from a sequential propagation with the same seed,
+ * except for a bundle of size one.
+ */
+class BatchPropagator {
+public:
+    BatchPropagator(Propagator propagator);
+    BatchPropagator(const ParticleDef& p_def, const nlohmann::json& config)
+        : BatchPropagator(Propagator(p_def, config))
+    {
+    }
+    BatchPropagator(const ParticleDef& p_def, std::vector<Sector> sectors)
+        : BatchPropagator(Propagator(p_def, std::move(sectors)))
+    {
+    }
+
+    /*!
+     * Propagate all particles with the same conditions as
+     * Propagator::Propagate. The i-th returned track belongs to the i-th
+     * initial particle.
+     */
+    std::vector<Secondaries> Propagate(
+        const std::vector<ParticleState>& initial_particles,
+        double max_distance = 1e20, double min_energy = 0.,
+        unsigned int hierarchy_condition = 0);
+
+private:
+    struct Lane {
+        ParticleState state;
+        Sector sector;
+        size_t sector_idx;
+        std::array<double, 3> interaction_energies;
+        int next_interaction_type;
+        int advancement_type;
+    };
+
+    size_t SectorIndex(const Sector&) const;
+    // returns true if the sector of the lane has changed
+    bool UpdateSectorIndex(Lane&) const;
+    void InteractionEnergies(std::vector<Lane>&,
+        const std::vector<size_t>& bucket, double min_energy,
+        std::function<double()> rnd);
+
+    Propagator propagator;
+
+    // reused buffers of the batched evaluation of one sector
+    std::vector<double> energy;
+    std::vector<double> local_density;
+    std::vector<double> rnd_decay;
+    std::vector<double> rnd_interaction;
+    std::vector<double> decay_energy;
+    std::vector<double> interaction_energy;
+};
+} // namespace PROPOSAL
@@ -0,0 +1,93 @@
+#pragma once
+
+#include "PROPOSAL/Propagator.h"
+#include "PROPOSAL/secondaries/SecondariesCalculator.h"
+#include <cstdint>
+
+namespace PROPOSAL {
+/*!
+ * Particle in a cascade tree. The tree is stored as a flat vector of nodes,
+ * every node refers to the node of the particle it was produced by. Parents
+ * are always stored before their children.
+ */
+struct CascadeNode {
+    ParticleState initial_state;
+    ParticleState final_state; //!< equal to initial state if not propagated
+    int parent; //!< index of the parent node, -1 for the primary
+    InteractionType origin; //!< interaction of the parent producing the node
+    bool propagated; //!< false if below threshold or no propagator available
+};
+
+/*!
+ * Propagates a primary particle including all secondaries above an energy
+ * threshold.
+ *
+ * For every particle type, a Propagator and a SecondariesCalculator are
+ * provided. The stochastic losses and decays of a propagated particle are
+ * resolved into secondary particles, which are queued for propagation if
+ * their energy is above the threshold and a propagator for their type is
+ * available. The queue is processed by a pool of worker threads stealing work
+ * from each other. Each worker owns its own propagators and calculators, since
+ * they are not safe to be shared between threads.
+ *
+ * Losses of interaction types without a secondaries parametrization are not
+ * resolved further.
+ *
+ * Only the seed of the primary is drawn from the global RandomGenerator. Every
+ * particle is propagated with its own random stream, seeded from the seed of
+ * its parent and its position among the parent's secondaries. The nodes are
+ * returned in breadth-first order with the children in the order they have
+ * been produced. The cascade therefore only depends on the state of the
+ * global generator, not on the number of threads or the scheduling.
+ */
+class Cascade {
+public:
+    struct Handler {
+        std::unique_ptr<Propagator> propagator;
+        std::unique_ptr<SecondariesCalculator> secondaries;
+    };
+    using HandlerFactory = std::function<Handler(const ParticleDef&)>;
+
+    Cascade(std::vector<ParticleDef> p_defs, HandlerFactory factory,
+        double energy_threshold, size_t n_threads = 1);
+
+    /*!
+     * Builds the propagators from the json config and calculates the
+     * secondaries of all default cross sections of a particle available in
+     * the medium.
+     */
+    Cascade(std::vector<ParticleDef> p_defs, const nlohmann::json& config,
+        const Medium& medium, double energy_threshold, size_t n_threads = 1);
+    Cascade(std::vector<ParticleDef> p_defs, const std::string& config_file,
+        const Medium& medium, double energy_threshold, size_t n_threads = 1)
+        : Cascade(std::move(p_defs), Propagator::ParseConfig(config_file),
+            medium, energy_threshold, n_threads)
+    {
+    }
+
+    std::vector<CascadeNode> Propagate(
+        const ParticleState& primary, double max_distance = 1e20);
+
+private:
+    struct Task {
+        size_t node;
+        ParticleState state;
+        uint64_t seed; //!< seed of the random stream of the task
+    };
+    struct Products {
+        ParticleState final_state;
+        std::vector<ParticleState> secondaries;
+        std::vector<InteractionType> origins;
+    };
+    class WorkQueue;
+
+    Products Process(const ParticleState&, Handler&, double max_distance);
+
+    std::vector<ParticleDef> p_defs;
+    double energy_threshold;
+    size_t n_threads;
+
+    // one map of handlers per worker, the key is the particle type
+    std::vector<std::unordered_map<int, Handler>> handlers;
+};
+} // namespace PROPOSAL
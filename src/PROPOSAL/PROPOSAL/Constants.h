@@ -60,6 +60,17 @@ struct InterpolationSettings {
     static unsigned int NODES_RATE_INTERPOLANT;
 };
 
+// integration settings
+struct IntegrationSettings {
+    // backend of smooth inner integrals, read by parametrizations at
+    // construction, see InnerIntegration
+    enum Method { ADAPTIVE, GAUSS_LEGENDRE, VERIFY };
+
+    static Method INNER_INTEGRATION;
+    static unsigned int GAUSS_LEGENDRE_ORDER;
+    static double VERIFICATION_TOLERANCE;
+};
+
 // propagation settings
 struct PropagationSettings {
     static unsigned int ADVANCE_PARTICLE_MAX_STEPS;
@@ -36,6 +36,8 @@
 #include "PROPOSAL/geometry/Box.h"
 #include "PROPOSAL/geometry/Cylinder.h"
 #include "PROPOSAL/geometry/GeometryFactory.h"
+#include "PROPOSAL/geometry/LayeredSphere.h"
+#include "PROPOSAL/geometry/Mesh.h"
 #include "PROPOSAL/geometry/Sphere.h"
 
 #include "PROPOSAL/crosssection/parametrization/Annihilation.h"
@@ -119,18 +121,23 @@
 
 #include "PROPOSAL/math/Cartesian3D.h"
 #include "PROPOSAL/math/Function.h"
+#include "PROPOSAL/math/GaussLegendre.h"
 #include "PROPOSAL/math/Integral.h"
 #include "PROPOSAL/math/Interpolant.h"
 #include "PROPOSAL/math/InterpolantBuilder.h"
+#include "PROPOSAL/math/InverseCDFTable.h"
 #include "PROPOSAL/math/MathMethods.h"
 #include "PROPOSAL/math/RandomGenerator.h"
 #include "PROPOSAL/math/Spherical3D.h"
 #include "PROPOSAL/math/Spline.h"
 #include "PROPOSAL/math/TableWriter.h"
+#include "PROPOSAL/math/TabulatedCubic.h"
 
 #include "PROPOSAL/particle/Particle.h"
 #include "PROPOSAL/particle/ParticleDef.h"
 
+#include "PROPOSAL/BatchPropagator.h"
+#include "PROPOSAL/Cascade.h"
 #include "PROPOSAL/Propagator.h"
 
 #include "PROPOSAL/propagation_utility/ContRand.h"
@@ -148,6 +155,7 @@
 #include "PROPOSAL/propagation_utility/TimeBuilder.h"
 
 #include "PROPOSAL/scattering/stochastic_deflection/ScatteringFactory.h"
+#include "PROPOSAL/scattering/stochastic_deflection/RmsThetaTable.h"
 #include "PROPOSAL/scattering/stochastic_deflection/bremsstrahlung/Bremsstrahlung.h"
 #include "PROPOSAL/scattering/stochastic_deflection/bremsstrahlung/BremsTsaiApproximation.h"
 #include "PROPOSAL/scattering/stochastic_deflection/bremsstrahlung/BremsGinneken.h"
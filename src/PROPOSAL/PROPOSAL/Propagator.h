@@ -1,6 +1,7 @@
 #pragma once
 
 #include "PROPOSAL/Secondaries.h"
+#include <functional>
 #include <nlohmann/json.hpp>
 #include <unordered_map>
 
@@ -8,6 +9,7 @@ namespace PROPOSAL {
 struct ParticleDef;
 
 class Geometry;
+class LayeredSphere;
 
 using Sector = std::tuple<std::shared_ptr<const Geometry>, PropagationUtility,
     std::shared_ptr<const Density_distr>>;
@@ -17,6 +19,8 @@ struct CrossSectionBase;
 
 namespace PROPOSAL {
 class Propagator {
+    friend class BatchPropagator;
+
 public:
     Propagator(const ParticleDef& p_def, const nlohmann::json& config);
     Propagator(const ParticleDef& p_def, const std::string& config_file)
@@ -28,8 +32,31 @@ public:
     Secondaries Propagate(const ParticleState& initial_particle,
         double max_distance = 1e20, double min_energy = 0.,
         unsigned int hierarchy_condition = 0);
+
+    /*!
+     * Signature of a sink receiving the propagation output. It is called for
+     * every particle state that Propagate would append to the Secondaries
+     * track, together with the interaction type and the hash of the target
+     * (0 for continuous losses). The energy of a loss is the difference to
+     * the energy of the previously received state.
+     */
+    using TrackSink = std::function<void(
+        const ParticleState&, InteractionType, size_t)>;
+
+    /*!
+     * Propagate the particle without storing the track. Instead of
+     * accumulating all particle states in a Secondaries object, each state is
+     * passed to the sink as soon as it has been calculated, so that the memory
+     * needed per propagated particle does not depend on the track length.
+     * Consumes the same random numbers as the Secondaries returning version.
+     */
+    void Propagate(const ParticleState& initial_particle, TrackSink sink,
+        double max_distance = 1e20, double min_energy = 0.,
+        unsigned int hierarchy_condition = 0);
     enum { GEOMETRY, UTILITY, DENSITY_DISTR };
 
+    static nlohmann::json ParseConfig(const std::string& config_file);
+
 private:
     Interaction::Loss DoStochasticInteraction(
         ParticleState&, PropagationUtility&, std::function<double()>);
@@ -37,8 +64,11 @@ private:
                         const double max_distance, std::function<double()> rnd,
                         Sector& current_sector, bool min_energy_step,
                         const double min_energy);
+    // distance_border is the distance to the border of current_geometry,
+    // which the caller usually knows already
     double CalculateDistanceToBorder(const Vector3D& particle_position,
-        const Vector3D& particle_direction, const Geometry& current_geometry);
+        const Vector3D& particle_direction, const Geometry& current_geometry,
+        double distance_border);
     int maximize(const std::array<double, 3>& InteractionEnergies);
     int minimize(const std::array<double, 3>& AdvanceDistances);
     Sector GetCurrentSector(
@@ -56,7 +86,6 @@ private:
     };
 
     // Initializing methods
-    static nlohmann::json ParseConfig(const std::string& config_file);
     void InitializeSectorFromJSON(
         const ParticleDef&, const nlohmann::json&, GlobalSettings);
 
@@ -84,6 +113,17 @@ private:
     };
 
     std::vector<Sector> sector_list;
+
+    // Sectors with concentric spherical shells of the same hierarchy, which
+    // border on each other, are grouped. The shell of a position is then
+    // found by a binary search in the radii instead of testing every sector.
+    struct SphereLayers {
+        std::shared_ptr<const LayeredSphere> geometry;
+        std::vector<size_t> sectors; // sector of every layer
+    };
+    void InitializeSphereLayers();
+    std::vector<SphereLayers> sphere_layers;
+    std::vector<bool> in_sphere_layers;
 };
 
 } // namespace PROPOSAL
@@ -27,6 +27,7 @@
 
 #pragma once
 
+#include <array>
 #include <memory>
 #include <string>
 #include <vector>
@@ -53,7 +54,9 @@ public:
      * interactions during the propagation.
      *
      * For this, it stores all intermediate particle states during propagation
-     * in a track object, which is a list of ParticleState objects.
+     * in a track object. The track is stored column-wise, i.e. there is one
+     * contiguous array per particle state attribute, which can be accessed
+     * without copying. ParticleState objects are assembled on request.
      * @param p_def ParticleDef describing the physics of the propagated
      * particle
      * @param sectors List of sectors of the original propagator. This is
@@ -68,14 +71,14 @@ public:
      * @return ParticleState object, describing the particle at the beginning
      * of the propagation
      */
-    ParticleState GetInitialState() const { return track_.front(); }
+    ParticleState GetInitialState() const { return (*this)[0]; }
 
     /*!
      * Get information on the final state of the propagated particle
      * @return ParticleState object, describing the particle after the
      * propagation
      */
-    ParticleState GetFinalState() const { return track_.back(); }
+    ParticleState GetFinalState() const { return back(); }
 
     /*!
      * Get information on the state of the propagated particle when it has
@@ -272,7 +275,7 @@ public:
      * @return List of ParticleState objects describing the states of the
      * particle during propagation.
      */
-    std::vector<ParticleState> GetTrack() const { return track_; };
+    std::vector<ParticleState> GetTrack() const;
 
     /*!
      * Returns the particle track, but only the particle states of the
@@ -296,6 +299,18 @@ public:
      */
     std::vector<Cartesian3D> GetTrackPositions() const;
 
+    /*!
+     * Returns the stored x, y, z coordinates (in cm) of all particle
+     * positions during propagation as a contiguous array, without copying.
+     * @return Reference to the list of cartesian coordinates of the particle
+     * positions. The reference is valid as long as the Secondaries object
+     * is not modified.
+     */
+    const std::vector<std::array<double, 3>>& GetTrackPositionCoordinates() const
+    {
+        return positions_;
+    };
+
     /*!
      * Returns the list of all directions of the propagated particle. The first
      * element corresponds to the direction of the initial particle, the last
@@ -307,6 +322,18 @@ public:
      */
     std::vector<Cartesian3D> GetTrackDirections() const;
 
+    /*!
+     * Returns the stored x, y, z components of all particle directions during
+     * propagation as a contiguous array, without copying.
+     * @return Reference to the list of cartesian components of the particle
+     * directions. The reference is valid as long as the Secondaries object
+     * is not modified.
+     */
+    const std::vector<std::array<double, 3>>& GetTrackDirectionCoordinates() const
+    {
+        return directions_;
+    };
+
     /*!
      * Returns the list of all particle energies (total energies in MeV) of the
      * propagated particle. The first element corresponds to the energy of the
@@ -314,9 +341,10 @@ public:
      * after propagation. The elements in between describe the energies of the
      * particle during propagation.
      * @return List of doubles, describing the particle energies during
-     * propagation (in total energies, in MeV)
+     * propagation (in total energies, in MeV). This is a reference to the
+     * stored array, no copy is made.
      */
-    std::vector<double> GetTrackEnergies() const;
+    const std::vector<double>& GetTrackEnergies() const { return energies_; };
 
     /*!
      * Returns the list of all particle times (times in s) of the propagated
@@ -325,9 +353,9 @@ public:
      * The elements in between describe the times of the particle during
      * propagation.
      * @return List of doubles, describing the particle times during propagation
-     * (in s)
+     * (in s). This is a reference to the stored array, no copy is made.
      */
-    std::vector<double> GetTrackTimes() const;
+    const std::vector<double>& GetTrackTimes() const { return times_; };
 
     /*!
      * Returns the list of the propagated distances (in cm) of the propagated
@@ -337,16 +365,21 @@ public:
      * propagation. The elements in between describe the propagated distances
      * during propagation
      * @return List of doubles, describing the particle propagated distances
-     * during propgation (in cm)
+     * during propgation (in cm). This is a reference to the stored array, no
+     * copy is made.
      */
-    std::vector<double> GetTrackPropagatedDistances() const;
+    const std::vector<double>& GetTrackPropagatedDistances() const
+    {
+        return propagated_distances_;
+    };
 
     /*!
      * Returns a list of interaction types describing the interactions of the
      * particle during propagation.
-     * @return List of InteractionType objects
+     * @return List of InteractionType objects. This is a reference to the
+     * stored array, no copy is made.
      */
-    std::vector<InteractionType> GetTrackTypes() const { return types_; };
+    const std::vector<InteractionType>& GetTrackTypes() const { return types_; };
 
     /*!
      * Returns a list of hashes, describing the media and components that the
@@ -363,28 +396,28 @@ public:
      * corresponding hash using Component::GetComponentForHash().
      * @return List of size_t objects, which are hashed to Medium or Component
      * objects. These are the targets that our particle interacted with during
-     * propagation.
+     * propagation. This is a reference to the stored array, no copy is made.
      */
-    std::vector<size_t> GetTargetHashes() const { return target_hashes_; };
+    const std::vector<size_t>& GetTargetHashes() const { return target_hashes_; };
 
     /*!
      * Length of the track objects, i.e. the number of particle states that are
      * stored in this Secondaries class.
      * @return unsigned int which describes the length of the track object.
      */
-    unsigned int GetTrackLength() const { return track_.size(); };
+    unsigned int GetTrackLength() const { return energies_.size(); };
 
     // Operational functions to fill and access track
     void reserve(size_t number_secondaries);
-    void clear() { track_.clear(); types_.clear(); target_hashes_.clear(); };
+    void clear();
     void push_back(const ParticleState& point, const InteractionType& type,
                    const size_t& target_hash = 0);
     void emplace_back(const ParticleType& particle_type, const Vector3D& position,
                       const Vector3D& direction, const double& energy, const double& time,
                       const double& distance, const InteractionType& interaction_type,
                       const size_t& target_hash = 0);
-    const ParticleState& back() const {return track_.back(); }
-    const ParticleState& operator[](std::size_t idx) { return track_[idx]; };
+    ParticleState back() const { return (*this)[energies_.size() - 1]; }
+    ParticleState operator[](std::size_t idx) const;
 
 private:
     ParticleState RePropagateDistance(const ParticleState& init_state,
@@ -396,8 +429,15 @@ private:
                                     double max_distance) const;
     Sector GetCurrentSector(const Vector3D& position,
                             const Vector3D& direction) const;
-
-    std::vector<ParticleState> track_;
+    StochasticLoss stochastic_loss(size_t idx) const;
+    ContinuousLoss continuous_loss(size_t idx) const;
+
+    std::vector<int> particle_types_;
+    std::vector<std::array<double, 3>> positions_;
+    std::vector<std::array<double, 3>> directions_;
+    std::vector<double> energies_;
+    std::vector<double> times_;
+    std::vector<double> propagated_distances_;
     std::vector<InteractionType> types_;
     std::vector<size_t> target_hashes_;
     std::shared_ptr<ParticleDef> primary_def_;
@@ -29,6 +29,7 @@
 #pragma once
 
 #include "PROPOSAL/crosssection/parametrization/Parametrization.h"
+#include "PROPOSAL/math/GaussLegendre.h"
 
 #define EPAIR_PARAM_INTEGRAL_DEC(param)                                        \
     struct Epair##param : public EpairProductionRhoIntegral {                  \
@@ -101,6 +102,9 @@ namespace crosssection {
         // ----------------------------------------------------------------------------
         virtual double FunctionToIntegral(const ParticleDef&, const Component&,
             double energy, double v, double rho) const = 0;
+
+    protected:
+        InnerIntegration inner_integration;
     };
 
     EPAIR_PARAM_INTEGRAL_DEC(KelnerKokoulinPetrukhin)
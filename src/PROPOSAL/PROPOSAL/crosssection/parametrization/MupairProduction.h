@@ -32,6 +32,7 @@
 #include <functional>
 
 #include "PROPOSAL/crosssection/parametrization/Parametrization.h"
+#include "PROPOSAL/math/GaussLegendre.h"
 #include "PROPOSAL/math/Integral.h"
 
 #define MUPAIR_PARAM_INTEGRAL_DEC(param)                                       \
@@ -85,6 +86,9 @@ namespace crosssection {
 
         virtual double DifferentialCrossSection(
             const ParticleDef&, const Component&, double, double) const;
+
+    protected:
+        InnerIntegration inner_integration;
     };
 
     MUPAIR_PARAM_INTEGRAL_DEC(KelnerKokoulinPetrukhin)
@@ -28,36 +28,78 @@
 
 
 #pragma once
+
+#include <cstddef>
 #include <vector>
+
 namespace PROPOSAL {
 
+    /*!
+     * Read-only view on a tabulated parameter array. The data are static
+     * constant arrays, so views can be copied freely and are valid for the
+     * whole runtime.
+     */
+    struct ParamArray {
+        const double* data;
+        size_t size;
+
+        constexpr const double* begin() const noexcept { return data; }
+        constexpr const double* end() const noexcept { return data + size; }
+        constexpr double operator[](size_t i) const { return data[i]; }
+
+        std::vector<double> ToVector() const { return { begin(), end() }; }
+    };
+
+    /*!
+     * Read-only view on a two-dimensional parameter table, stored row by row
+     * in one contiguous array.
+     */
+    struct ParamTable {
+        const double* data;
+        size_t rows;
+        size_t cols;
+
+        constexpr ParamArray operator[](size_t i) const
+        {
+            return { data + i * cols, cols };
+        }
+
+        std::vector<std::vector<double>> ToVector() const
+        {
+            auto v = std::vector<std::vector<double>>();
+            v.reserve(rows);
+            for (size_t i = 0; i < rows; ++i)
+                v.push_back((*this)[i].ToVector());
+            return v;
+        }
+    };
+
     // Weak Interaction
 
-    const extern std::vector<double> energies;
+    extern const ParamArray energies;
 
-    const extern std::vector< std::vector<double> > y_nu_p;
-    const extern std::vector< std::vector<double> > y_nubar_p;
-    const extern std::vector< std::vector<double> > y_nu_n;
-    const extern std::vector< std::vector<double> > y_nubar_n;
+    extern const ParamTable y_nu_p;
+    extern const ParamTable y_nubar_p;
+    extern const ParamTable y_nu_n;
+    extern const ParamTable y_nubar_n;
 
-    const extern std::vector< std::vector<double> > sigma_nu_p;
-    const extern std::vector< std::vector<double> > sigma_nubar_p;
-    const extern std::vector< std::vector<double> > sigma_nu_n;
-    const extern std::vector< std::vector<double> > sigma_nubar_n;
+    extern const ParamTable sigma_nu_p;
+    extern const ParamTable sigma_nubar_p;
+    extern const ParamTable sigma_nu_n;
+    extern const ParamTable sigma_nubar_n;
 
     // BremsElectronScreening
 
-    const extern std::vector<double> A_energies;
-    const extern std::vector<double> A_logZ;
+    extern const ParamArray A_energies;
+    extern const ParamArray A_logZ;
 
-    const extern std::vector< std::vector<double> > A_correction;
+    extern const ParamTable A_correction;
 
     // PhotoPairKochMotz
 
-    const extern std::vector<double> photopair_KM_energies;
-    const extern std::vector<double> photopair_KM_Z;
-
-    const extern std::vector< std::vector<double> > photopair_KM_cross;
+    extern const ParamArray photopair_KM_energies;
+    extern const ParamArray photopair_KM_Z;
 
+    extern const ParamTable photopair_KM_cross;
 
 } // namespace PROPOSAL
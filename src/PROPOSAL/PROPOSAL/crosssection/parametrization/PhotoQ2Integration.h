@@ -29,6 +29,7 @@
 #pragma once
 
 #include "PROPOSAL/crosssection/parametrization/Photonuclear.h"
+#include "PROPOSAL/math/GaussLegendre.h"
 #include "PROPOSAL/methods.h"
 
 #define Q2_PHOTO_PARAM_INTEGRAL_DEC(param)                                     \
@@ -100,6 +101,9 @@ namespace crosssection {
             const Component&, double energy, double v, double Q2) const = 0;
 
         std::shared_ptr<ShadowEffect> shadow_effect_;
+
+    protected:
+        InnerIntegration inner_integration;
     };
 
     Q2_PHOTO_PARAM_INTEGRAL_DEC(AbramowiczLevinLevyMaor91)
@@ -29,7 +29,7 @@
 #pragma once
 
 #include "PROPOSAL/crosssection/parametrization/Parametrization.h"
-#include "PROPOSAL/math/Interpolant.h"
+#include "PROPOSAL/math/TabulatedCubic.h"
 
 #include <vector>
 
@@ -61,7 +61,7 @@ namespace crosssection {
 
     class HardComponent : public RealPhoton {
         static std::vector<double> x;
-        std::vector<Interpolant> interpolant_;
+        std::vector<TabulatedCubic> interpolant_;
 
     public:
         HardComponent(const ParticleDef&);
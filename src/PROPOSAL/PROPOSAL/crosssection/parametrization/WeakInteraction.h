@@ -29,12 +29,12 @@
 #pragma once
 
 #include "PROPOSAL/crosssection/parametrization/Parametrization.h"
+#include "PROPOSAL/math/TabulatedCubic.h"
 
 #include <memory>
 #include <utility>
 
 namespace PROPOSAL {
-class Interpolant;
 class Component;
 } // namespace PROPOSAL;
 
@@ -60,7 +60,8 @@ namespace crosssection {
     };
 
     struct WeakCooperSarkarMertsch : public WeakInteraction {
-        using Interpolant_t = std::shared_ptr<Interpolant>;
+        // tables of the proton and neutron contribution in log10(E) and log(v)
+        using Interpolant_t = std::shared_ptr<const TabulatedCubic2D>;
         std::pair<Interpolant_t, Interpolant_t> interpolants_particle;
         std::pair<Interpolant_t, Interpolant_t> interpolants_antiparticle;
 
@@ -59,7 +59,19 @@ public:
     // Public methods
     // --------------------------------------------------------------------- //
 
-    virtual std::vector<ParticleState> Decay(const ParticleDef&, const ParticleState&) = 0;
+    std::vector<ParticleState> Decay(const ParticleDef&, const ParticleState&);
+
+    // ----------------------------------------------------------------------------
+    /// @brief Decay the particle into a given vector
+    ///
+    /// The vector is cleared and filled with the decay products. Reusing
+    /// the same vector for consecutive decays avoids an allocation per decay.
+    ///
+    /// @param ParticleDef of the decaying particle
+    /// @param ParticleState of the decaying particle
+    /// @param products vector to store the decay products
+    // ----------------------------------------------------------------------------
+    virtual void Decay(const ParticleDef&, const ParticleState&, std::vector<ParticleState>& products) = 0;
 
     // ----------------------------------------------------------------------------
     /// @brief Boost the particle along a direction
@@ -78,6 +90,20 @@ public:
     // ----------------------------------------------------------------------------
     static void Boost(ParticleState&, const Vector3D& direction, double gamma, double betagamma);
 
+    // ----------------------------------------------------------------------------
+    /// @brief Boost the particle with a known mass along a direction
+    ///
+    /// Same as Boost(ParticleState&, const Vector3D&, double, double), but the
+    /// mass is not looked up from the particle type.
+    ///
+    /// @param Particle
+    /// @param mass of the particle
+    /// @param direction
+    /// @param gamma = E/m
+    /// @param betagamma = beta*gamma = p/m
+    // ----------------------------------------------------------------------------
+    static void Boost(ParticleState&, double mass, const Vector3D& direction, double gamma, double betagamma);
+
     // ----------------------------------------------------------------------------
     /// @brief Boost a set of particles along a direction
     ///
@@ -91,6 +117,7 @@ public:
     // ----------------------------------------------------------------------------
     /* static void Boost(const DecayProducts&, const Vector3D& direction, double gamma, double betagamma); */
     static void Boost(std::vector<ParticleState>&, const Vector3D& direction, double gamma, double betagamma);
+    static void Boost(std::vector<ParticleState>&, const std::vector<double>& masses, const Vector3D& direction, double gamma, double betagamma);
 
     // ----------------------------------------------------------------------------
     /// @brief Calculate the momentum in a two-body-phase-space decay
@@ -121,6 +148,16 @@ public:
     // ----------------------------------------------------------------------------
     static Cartesian3D GenerateRandomDirection();
 
+    // ----------------------------------------------------------------------------
+    /// @brief Direction uniformly distributed on the unit sphere
+    ///
+    /// @param rnd_phi random number for the azimuth angle
+    /// @param rnd_theta random number for the cosine of the polar angle
+    ///
+    /// @return direction
+    // ----------------------------------------------------------------------------
+    static Cartesian3D GenerateRandomDirection(double rnd_phi, double rnd_theta);
+
     // ----------------------------------------------------------------------------
     /// @brief Sets the uniform flag in the ManyBodyPhaseSpace channels
     ///
@@ -60,7 +60,9 @@ public:
     // ----------------------------------------------------------------------------
     /// @brief Get a decay channel
     ///
-    /// The Decay channels will be sampled from the previous given branching ratios
+    /// The Decay channels will be sampled from the previous given branching ratios.
+    /// The channel is drawn from an alias table, so the selection needs
+    /// constant time independent of the number of channels.
     ///
     /// @return Sampled Decay channel
     // ----------------------------------------------------------------------------
@@ -101,7 +103,21 @@ public:
 private:
     void clearTable();
 
+    // ----------------------------------------------------------------------------
+    /// @brief Build the alias table of the channels
+    ///
+    /// Walker's alias method: every channel gets a bin of equal width. The
+    /// bin is filled by the channel up to alias_probability_ and by the
+    /// channel alias_index_ for the rest. Has to be called whenever the
+    /// channels change.
+    // ----------------------------------------------------------------------------
+    void buildAliasTable();
+
     DecayMap channels_;
+
+    std::vector<DecayChannel*> alias_channels_;
+    std::vector<double> alias_probability_;
+    std::vector<size_t> alias_index_;
 };
 
 std::ostream& operator<<(std::ostream&, PROPOSAL::DecayTable const&);
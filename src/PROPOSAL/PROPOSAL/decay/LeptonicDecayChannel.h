@@ -28,6 +28,9 @@
 
 #pragma once
 
+#include <memory>
+#include <vector>
+
 #include "PROPOSAL/decay/DecayChannel.h"
 #include "PROPOSAL/particle/ParticleDef.h"
 
@@ -44,7 +47,8 @@ public:
     // No copy and assignemnt -> done by clone
     DecayChannel* clone() const { return new LeptonicDecayChannelApprox(*this); }
 
-    std::vector<ParticleState> Decay(const ParticleDef&, const ParticleState&);
+    using DecayChannel::Decay;
+    void Decay(const ParticleDef&, const ParticleState&, std::vector<ParticleState>&);
 
     const std::string& GetName() const { return name_; }
 
@@ -70,6 +74,37 @@ protected:
     virtual double DifferentialDecayRate(double x, double parent_mass, double E_max);
 
     double FindRoot(double min, double parent_mass, double E_max, double right_side);
+
+    // ----------------------------------------------------------------------------
+    /// @brief Tabulated inverse of the integrated decay rate
+    ///
+    /// Holds the lepton energy fraction x at equidistant nodes in rnd^(1/3).
+    /// The spectrum rises like x^2 at low energies, so x is almost linear in
+    /// this variable and can be interpolated linearly.
+    // ----------------------------------------------------------------------------
+    struct EnergyTable
+    {
+        double parent_mass;
+        std::vector<double> x;
+    };
+
+    // ----------------------------------------------------------------------------
+    /// @brief Sample the lepton energy fraction from the tabulated spectrum
+    ///
+    /// The table is built on the first decay of a parent particle and shared
+    /// between all channels of the same type and masses in the process.
+    ///
+    /// @param parent_mass
+    /// @param rnd
+    ///
+    /// @return lepton energy divided by the maximal lepton energy
+    // ----------------------------------------------------------------------------
+    double SampleEnergyFraction(double parent_mass, double rnd);
+
+    std::shared_ptr<const EnergyTable> BuildEnergyTable(double parent_mass);
+    std::shared_ptr<const EnergyTable> GetEnergyTable(double parent_mass);
+
+    std::shared_ptr<const EnergyTable> energy_table_;
 };
 
 class LeptonicDecayChannel : public LeptonicDecayChannelApprox
@@ -31,6 +31,8 @@
 
 #include <unordered_map>
 #include <functional>
+#include <memory>
+#include <mutex>
 
 #include "PROPOSAL/decay/DecayChannel.h"
 #include "PROPOSAL/particle/ParticleDef.h"
@@ -56,7 +58,7 @@ public:
         double weight;
     };
 
-    typedef std::unordered_map<ParticleDef, PhaseSpaceParameters> ParameterMap;
+    typedef std::unordered_map<double, PhaseSpaceParameters> ParameterMap;
     typedef std::function<double(const ParticleState&, const std::vector<ParticleState>&)> MatrixElementFunction;
     typedef std::function<void(PhaseSpaceParameters&, const ParticleDef&)> EstimateFunction;
 
@@ -74,10 +76,24 @@ public:
     /// Calculate decay products with the help of the Raubold Lynch algorithm.
     ///
     /// @param Particle
+    /// @param products Vector of particles, the decay products
+    // ----------------------------------------------------------------------------
+    using DecayChannel::Decay;
+    void Decay(const ParticleDef& p_def, const ParticleState& p_condition, std::vector<ParticleState>& products);
+
+    // ----------------------------------------------------------------------------
+    /// @brief Many body phase space decay of several particles
     ///
-    /// @return Vector of particles, the decay products
+    /// All particles have to be of the same type. The random numbers are
+    /// drawn in blocks for all remaining events and consumed in the same order
+    /// as by consecutive single decays, so both give the same products.
+    ///
+    /// @param p_def ParticleDef of the decaying particles
+    /// @param p_conditions ParticleStates of the decaying particles
+    /// @param products Vector of decay products, the products of the i-th
+    ///        particle are stored at [i * n, (i + 1) * n) with n daughters
     // ----------------------------------------------------------------------------
-    std::vector<ParticleState> Decay(const ParticleDef& p_def, const ParticleState& p_condition);
+    void Decay(const ParticleDef& p_def, const std::vector<ParticleState>& p_conditions, std::vector<ParticleState>& products);
 
     // ----------------------------------------------------------------------------
     /// @brief Evalutate the matrix element of this channel
@@ -120,11 +136,42 @@ private:
     ///
     /// Calculate decay products with the help of the Raubold Lynch algorithm.
     ///
-    /// @param Particle
+    /// @param products Vector of particles, the decay products
+    /// @param kinematics
+    /// @param rnd two random numbers per direction of the daughters 1 to n-1
+    // ----------------------------------------------------------------------------
+    void GenerateEvent(std::vector<ParticleState>& products, const PhaseSpaceKinematics& kinematics, const double* rnd);
+
+    // ----------------------------------------------------------------------------
+    /// @brief Generate one event in the rest frame of the parent
+    ///
+    /// @param p_def
+    /// @param p_condition
+    /// @param params
+    /// @param products Vector of particles, the decay products
+    /// @param rnd random numbers of the event, see RandomsPerEvent
     ///
-    /// @return Vector of particles, the decay products
+    /// @return false if the event is rejected for uniform sampling
+    // ----------------------------------------------------------------------------
+    bool SampleEvent(const ParticleDef& p_def, const ParticleState& p_condition, const PhaseSpaceParameters& params, std::vector<ParticleState>& products, const double* rnd);
+
+    // ----------------------------------------------------------------------------
+    /// @brief Reset the decay products to the state of the parent
     // ----------------------------------------------------------------------------
-    void GenerateEvent(std::vector<ParticleState>& products, const PhaseSpaceKinematics& kinematics);
+    void InitProducts(std::vector<ParticleState>& products, const ParticleState& p_condition) const;
+
+    // ----------------------------------------------------------------------------
+    /// @brief Number of random numbers needed for one event
+    ///
+    /// The n-2 virtual masses, two per direction of the daughters 1 to n-1
+    /// and one for the rejection in case of uniform sampling.
+    // ----------------------------------------------------------------------------
+    size_t RandomsPerEvent() const;
+
+    // ----------------------------------------------------------------------------
+    /// @brief Fill the random number buffer for the given number of events
+    // ----------------------------------------------------------------------------
+    void DrawRandoms(size_t events, size_t randoms_per_event);
 
     // ----------------------------------------------------------------------------
     /// @brief Calculate the normalization of the phase space density
@@ -167,23 +214,24 @@ private:
     /// @param parent
     ///
     /// For every particle definition the normalization and maximum weight is unique.
-    /// Both values will be created and stored in an hash table.
+    /// Both values will be created and stored in an hash table, which is shared
+    /// by all copies of the channel.
     ///
     /// @return struct containing the normalization and maximum weight
     // ----------------------------------------------------------------------------
-    PhaseSpaceParameters GetPhaseSpaceParams(const ParticleDef& parent_def);
+    const PhaseSpaceParameters& GetPhaseSpaceParams(const ParticleDef& parent_def);
 
 
     // ----------------------------------------------------------------------------
     /// @brief Calculate the kinematics for the use in the raubold lynch algorithm
     ///
+    /// @param kinematics struct to store the weight of the phase space point,
+    ///        intermediate momenta and virtual masses for the algorithm.
     /// @param normalization
     /// @param parent_mass
-    ///
-    /// @return struct containing the weight of the phase space point,
-    ///         intermediate momenta and virtual masses for the algorithm.
+    /// @param rnd n-2 random numbers for the virtual masses
     // ----------------------------------------------------------------------------
-    PhaseSpaceKinematics CalculateKinematics(double normalization, double parent_mass);
+    void CalculateKinematics(PhaseSpaceKinematics& kinematics, double normalization, double parent_mass, const double* rnd);
 
     bool compare(const DecayChannel&) const;
     void print(std::ostream&) const;
@@ -202,7 +250,21 @@ private:
 
     static const std::string name_;
 
-    ParameterMap parameter_map_;
+    // parameters per parent mass. Channels are cloned with every copy of
+    // their ParticleDef, so the copies share the parameters instead of
+    // estimating the maximum weight again.
+    struct ParameterCache
+    {
+        std::mutex mutex;
+        ParameterMap parameters;
+    };
+    std::shared_ptr<ParameterCache> parameter_cache_;
+
+    // scratch space reused between decays
+    PhaseSpaceKinematics kinematics_;
+    std::vector<double> randoms_;
+    std::vector<double> sorted_randoms_;
+    std::vector<ParticleState> event_products_;
 };
 
 class ManyBodyPhaseSpace::Builder
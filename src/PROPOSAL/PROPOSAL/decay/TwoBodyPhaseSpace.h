@@ -46,7 +46,8 @@ public:
     // No copy and assignemnt -> done by clone
     DecayChannel* clone() const { return new TwoBodyPhaseSpace(*this); }
 
-    std::vector<ParticleState> Decay(const ParticleDef& p_def, const ParticleState& p_condition);
+    using DecayChannel::Decay;
+    void Decay(const ParticleDef& p_def, const ParticleState& p_condition, std::vector<ParticleState>& products);
 
     const std::string& GetName() const { return name_; }
 
@@ -77,9 +77,20 @@ class Density_splines : public Density_distr {
                            double l) const;
 
    protected:
+    void init_grammage_nodes();
+    double correct_iterative(const Vector3D& xi,
+                             const Vector3D& direction,
+                             double res,
+                             double distance_to_border) const;
+
     Spline* spline_;
     Spline* integrated_spline_;
 
+    // integrated_spline_ at the borders of the subintervalls, empty if the
+    // antiderivative is not strictly increasing
+    std::vector<double> depth_nodes_;
+    std::vector<double> grammage_nodes_;
+
     std::function<double(double)> density_distribution;
     std::function<double(double)> antiderived_density_distribution;
 };
@@ -29,6 +29,7 @@
 
 #pragma once
 
+#include <array>
 #include <map>
 #include <memory>
 #include <nlohmann/json_fwd.hpp>
@@ -44,6 +45,18 @@ public:
         enum Enum { InfrontGeometry= 0, InsideGeometry, BehindGeometry };
     };
 
+    /*!
+     * Results of the location queries for one particle position and
+     * direction. See GetIntersections.
+     */
+    struct Intersections {
+        std::pair<double, double> forward;  //!< DistanceToBorder in direction
+        std::pair<double, double> backward; //!< DistanceToBorder in opposite direction
+        ParticleLocation::Enum location;    //!< as returned by GetLocation
+        bool is_entering;                   //!< as returned by IsEntering
+        bool is_leaving;                    //!< as returned by IsLeaving
+    };
+
 public:
     Geometry(const std::string, const Vector3D& position);
     Geometry(const nlohmann::json&);
@@ -84,6 +97,20 @@ public:
      */
     virtual std::pair<double, double> DistanceToBorder(const Vector3D& position, const Vector3D& direction) const = 0;
 
+    /*!
+     * Answers all location queries for the particle at once. The
+     * intersections in both directions are calculated together, so this is
+     * cheaper than calling IsInside, IsEntering, IsLeaving, ... one after
+     * the other, which each calculate the intersections again.
+     */
+    Intersections GetIntersections(const Vector3D& position, const Vector3D& direction) const;
+
+    /*!
+     * Location of the particle for the result of DistanceToBorder, to avoid
+     * recalculating the intersections if the distance is needed anyway.
+     */
+    static ParticleLocation::Enum GetLocation(const std::pair<double, double>& distance);
+
     /*!
      * Calculates the distance to the closest approch to the geometry center
      */
@@ -108,6 +135,12 @@ public:
     void SetHierarchy(unsigned int hierarchy) { hierarchy_ = hierarchy; };
 
 protected:
+    /*!
+     * DistanceToBorder in direction and in the opposite direction. Child
+     * classes can override this to share the calculation of both.
+     */
+    virtual std::array<std::pair<double, double>, 2> DistancesToBorder(const Vector3D& position, const Vector3D& direction) const;
+
     // Implemented in child classes to be able to use equality operator
     virtual bool compare(const Geometry&) const = 0;
     virtual void print(std::ostream&) const     = 0;
@@ -121,9 +154,9 @@ protected:
 } // namespace PROPOSAL
 
 namespace PROPOSAL {
-    enum Geometry_Type : int { SPHERE, BOX, CYLINDER };
+    enum Geometry_Type : int { SPHERE, BOX, CYLINDER, MESH };
 } // namespace PROPOSAL
 
 namespace PROPOSAL {
-    const std::array<std::string, 3>  Geometry_Name = { "sphere", "box", "cylinder" };
+    const std::array<std::string, 4>  Geometry_Name = { "sphere", "box", "cylinder", "mesh" };
 } // namespace PROPOSAL
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <vector>
+
+#include "PROPOSAL/geometry/Geometry.h"
+
+namespace PROPOSAL {
+
+/*!
+ * Concentric spherical layers, like the shells of an earth model.
+ *
+ * Layer i extends from radii[i] to radii[i + 1]. As a geometry, the layered
+ * sphere is the hollow sphere between the innermost and the outermost radius.
+ * The layer of a position is found by a binary search in the radii, and the
+ * distance to the next layer border only needs the intersections with the
+ * radii next to the position.
+ */
+class LayeredSphere : public Geometry
+{
+public:
+    LayeredSphere(const Vector3D& position, std::vector<double> radii);
+
+    // Methods
+    std::pair<double, double> DistanceToBorder(const Vector3D& position, const Vector3D& direction) const override;
+
+    /*!
+     * Layer enclosing the position. Positions outside of the layered sphere
+     * are assigned to the innermost or outermost layer.
+     */
+    size_t GetLayer(const Vector3D& position) const;
+
+    /*!
+     * Distance to the next intersection of the particle trajectory with any
+     * of the radii, -1 if there is none. As in DistanceToBorder,
+     * intersections closer than GEOMETRY_PRECISION are ignored.
+     */
+    double DistanceToLayerBorder(const Vector3D& position, const Vector3D& direction) const;
+
+    // Getter
+    const std::vector<double>& GetRadii() const { return radii_; }
+    size_t GetNumberOfLayers() const { return radii_.size() - 1; }
+
+private:
+    bool compare(const Geometry&) const override;
+    void print(std::ostream&) const override;
+
+    size_t find_layer(double radius) const;
+
+    std::vector<double> radii_; //!< borders of the layers in ascending order
+};
+
+} // namespace PROPOSAL
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <array>
+#include <string>
+#include <vector>
+
+#include "PROPOSAL/geometry/Geometry.h"
+
+namespace PROPOSAL {
+
+/*!
+ * Closed surface given by a triangle mesh, e.g. a mountain topography or the
+ * walls of a cavern.
+ *
+ * The vertices are relative to the position of the geometry. Intersections
+ * of the particle trajectory are found by traversing a bounding volume
+ * hierarchy, so only triangles close to the trajectory are tested. Whether a
+ * particle is inside follows from the number of intersections in direction
+ * of the trajectory, therefore the mesh has to be watertight.
+ */
+class Mesh : public Geometry
+{
+public:
+    Mesh(const Vector3D& position,
+         const std::vector<std::array<double, 3>>& vertices,
+         const std::vector<std::array<size_t, 3>>& triangles);
+
+    /*!
+     * Reads the mesh from a Wavefront OBJ or ASCII PLY file, chosen by the
+     * file extension. The vertices are multiplied by scale, e.g. to convert
+     * from meter to centimeter.
+     */
+    Mesh(const Vector3D& position, const std::string& path, double scale = 1.);
+    Mesh(const nlohmann::json& config);
+
+    // Methods
+    std::pair<double, double> DistanceToBorder(const Vector3D& position, const Vector3D& direction) const override;
+
+    // Getter
+    size_t GetNumberOfTriangles() const { return v0_[0].size(); }
+
+private:
+    bool compare(const Geometry&) const override;
+    void print(std::ostream&) const override;
+
+    void build(const std::vector<std::array<double, 3>>& vertices,
+               const std::vector<std::array<size_t, 3>>& triangles);
+
+    struct Node {
+        std::array<double, 3> lower; //!< corner of the bounding box
+        std::array<double, 3> upper; //!< opposite corner of the bounding box
+        unsigned int first;          //!< first triangle of a leaf, right child otherwise
+        unsigned int count;          //!< number of triangles of a leaf, 0 otherwise
+    };
+
+    std::vector<Node> nodes_; //!< depth first, the left child follows its parent
+
+    // triangles in the order of the leaves, as structure of arrays of the
+    // first vertex and the two edges starting at it
+    std::array<std::vector<double>, 3> v0_;
+    std::array<std::vector<double>, 3> e1_;
+    std::array<std::vector<double>, 3> e2_;
+};
+
+} // namespace PROPOSAL
@@ -50,9 +50,14 @@ public:
     void SetRadius(double radius) { radius_ = radius; };
 
 private:
+    std::array<std::pair<double, double>, 2> DistancesToBorder(const Vector3D& position, const Vector3D& direction) const override;
     bool compare(const Geometry&) const override;
     void print(std::ostream&) const override;
 
+    // intersections for the squared distance to the center and the
+    // projection B of this distance on the direction
+    std::pair<double, double> distance_to_border(double difference_length_squared, double B) const;
+
     double radius_;       //!< the radius of the sphere/ cylinder
     double inner_radius_; //!< for spherical shells or hollow cylinder (0 for sphere / cylinder)
 };
@@ -1,4 +1,5 @@
 #pragma once
+#include "PROPOSAL/math/Vec3.h"
 #include "PROPOSAL/math/Vector3D.h"
 #include <nlohmann/json_fwd.hpp>
 
@@ -10,6 +11,7 @@ namespace PROPOSAL{
         Cartesian3D(std::array<double, 3> val) : Vector3D(val) {};
         Cartesian3D(double x, double y, double z) : Vector3D({x, y, z}) {};
         Cartesian3D(const Vector3D& vec) : Cartesian3D(vec.GetCartesianCoordinates()) {};
+        Cartesian3D(const Vec3& vec) : Vector3D({vec.x, vec.y, vec.z}) {};
         Cartesian3D(const nlohmann::json&);
 
         auto GetX() const {return coordinates[0];}
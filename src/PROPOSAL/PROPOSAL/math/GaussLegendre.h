@@ -0,0 +1,95 @@
+#pragma once
+
+#include "PROPOSAL/Constants.h"
+#include <cmath>
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace PROPOSAL {
+class Integral;
+
+/*!
+ * Gauss-Legendre quadrature of fixed order.
+ *
+ * Nodes and weights on [-1, 1] are calculated once in the constructor. An
+ * integration evaluates the integrand exactly at order() points, it does not
+ * allocate and has no branches depending on the integrand. This is suited
+ * for smooth integrands where the number of evaluations of an adaptive
+ * method is dominated by the convergence checks.
+ */
+class GaussLegendre {
+    std::vector<double> nodes;
+    std::vector<double> weights;
+
+public:
+    explicit GaussLegendre(unsigned int order);
+
+    unsigned int GetOrder() const noexcept { return nodes.size(); }
+    const std::vector<double>& GetNodes() const noexcept { return nodes; }
+    const std::vector<double>& GetWeights() const noexcept { return weights; }
+
+    template <typename F> double Integrate(double min, double max, F&& f) const
+    {
+        auto half_width = 0.5 * (max - min);
+        auto center = 0.5 * (max + min);
+        auto sum = 0.;
+        for (size_t i = 0; i < nodes.size(); ++i)
+            sum += weights[i] * f(center + half_width * nodes[i]);
+        return half_width * sum;
+    }
+
+    /*!
+     * Integration in log(x), equivalent to method 4 of Integral::Integrate.
+     * Both limits have to be positive.
+     */
+    template <typename F>
+    double IntegrateWithLog(double min, double max, F&& f) const
+    {
+        return Integrate(std::log(min), std::log(max), [&f](double t) {
+            auto x = std::exp(t);
+            return x * f(x);
+        });
+    }
+};
+
+/*!
+ * Backend of a smooth inner integral, like the rho integral of pair
+ * production or the Q2 integral of photonuclear interaction.
+ *
+ * The backend and the order are taken from IntegrationSettings when the
+ * object is constructed. Parametrizations hold one as a member, so that their
+ * hash and all of their integrations refer to the same backend, even if the
+ * global settings are changed later on.
+ */
+class InnerIntegration {
+    IntegrationSettings::Method backend;
+    double tolerance;
+    std::shared_ptr<const GaussLegendre> rule;
+
+public:
+    InnerIntegration();
+
+    //! true if the results are the ones of the fixed order rule
+    bool IsFixedOrder() const noexcept
+    {
+        return backend == IntegrationSettings::GAUSS_LEGENDRE;
+    }
+    unsigned int GetOrder() const noexcept
+    {
+        return rule ? rule->GetOrder() : 0;
+    }
+
+    /*!
+     * The arguments are the same as for Integral::Integrate, only the
+     * methods 1, 2 (linear) and 4 (logarithmic) have a Gauss-Legendre
+     * counterpart. All other methods are always integrated adaptively.
+     *
+     * In the verification mode both backends are evaluated, the adaptive
+     * result is returned and a warning is logged if the relative deviation
+     * exceeds the verification tolerance.
+     */
+    double Integrate(Integral& integral, double min, double max,
+        const std::function<double(double)>& integrand, int method) const;
+};
+} // namespace PROPOSAL
@@ -29,8 +29,8 @@
 
 #pragma once
 
+#include <array>
 #include <functional>
-#include <vector>
 
 namespace PROPOSAL {
 
@@ -62,6 +62,15 @@ class Integral
 {
 
 public:
+    /*!
+     * The workspace of the integrator has a fixed size, so that no memory is
+     * allocated when an Integral is created in a hot loop. Larger settings are
+     * clamped to these capacities.
+     */
+    static constexpr int max_romberg_steps = 32; //!< maximal maxSteps_romberg
+    static constexpr int max_romberg_order = 16; //!< maximal romberg
+    static constexpr int max_qags_intervals = 50; //!< maximal limit of qags
+
     /**
      * initializes class with default settings
      */
@@ -114,7 +123,7 @@ public:
 
     double Integrate(double min,
                      double max,
-                     std::function<double(double)> integrand,
+                     const std::function<double(double)>& integrand,
                      int method,
                      double powerOfSubstitution = 0);
 
@@ -139,7 +148,7 @@ public:
 
     double IntegrateWithRandomRatio(double min,
                                     double max,
-                                    std::function<double(double)> integrand,
+                                    const std::function<double(double)>& integrand,
                                     int method,
                                     double randomRatio,
                                     double powerOfSubstitution = 0);
@@ -177,7 +186,7 @@ public:
     /*                  "Integral::integrateOpened(...) to set the function to use, and its range...\n"; */
     /*     this->integrand_ = integrand; */
     /* } */
-    void SetIntegrand(std::function<double(double)> integrand);
+    void SetIntegrand(const std::function<double(double)>& integrand);
     void SetMax(double max);
     void SetMaxStepsUpperLimit(int maxSteps);
     void SetMaxStepsRomberg(int maxSteps);
@@ -224,11 +233,11 @@ private:
     double precision_;
     double max_, min_;
 
-    std::vector<double> iX_;
-    std::vector<double> iY_;
+    std::array<double, max_romberg_steps> iX_;
+    std::array<double, max_romberg_steps> iY_;
 
-    std::vector<double> c_;
-    std::vector<double> d_;
+    std::array<double, max_romberg_order> c_;
+    std::array<double, max_romberg_order> d_;
 
     std::function<double(double)> integrand_;
 
@@ -242,9 +251,13 @@ private:
     double reverseX_;
     double savedResult_;
 
-    std::vector<double> q_last_3_results_;
-    std::vector<double> q_rlist2_; // epstab
-    std::vector<double> q_iord_;
+    // the maximum number of elements the epsilon table can contain.
+    // if this number is reached, the upper diagonal of the epsilon table is deleted.
+    static constexpr int q_limit_epsilon_table_ = 50;
+
+    std::array<double, 3> q_last_3_results_;
+    std::array<double, q_limit_epsilon_table_ + 2> q_rlist2_; // epstab
+    std::array<double, max_qags_intervals> q_iord_;
 
     // ----------------------------------------------------------------------------
     /// @brief This function is a translation of the fortran 77 subroutine
@@ -266,7 +279,7 @@ private:
     ///        dqpsrt from the package QUADPACK by Piessens et al. (1983),
     ///        which is needed by qags.
     // ----------------------------------------------------------------------------
-    int q_sort(int q_limit, int last, int maxerr, int nrmax, const std::vector<double>& q_elist);
+    int q_sort(int q_limit, int last, int maxerr, int nrmax, const std::array<double, max_qags_intervals>& q_elist);
 
     // ----------------------------------------------------------------------------
     /// @brief QUADPACK implementation of the gauss kronrod integration.
@@ -442,25 +455,25 @@ private:
 
     //----------------------------------------------------------------------------//
 
-    double InitIntegralOpenedAndClosed(double min, double max, std::function<double(double)> integrand);
+    double InitIntegralOpenedAndClosed(double min, double max, const std::function<double(double)>& integrand);
 
     //----------------------------------------------------------------------------//
 
     double InitIntegralWithSubstitution(double min,
                                         double max,
-                                        std::function<double(double)> integrand,
+                                        const std::function<double(double)>& integrand,
                                         double powerOfSubstitution);
 
     //----------------------------------------------------------------------------//
 
     double InitIntegralWithLogSubstitution(double min,
                                            double max,
-                                           std::function<double(double)> integrand,
+                                           const std::function<double(double)>& integrand,
                                            double powerOfSubstitution);
 
     //----------------------------------------------------------------------------//
 
-    double InitIntegralWithLog(double min, double max, std::function<double(double)> integrand);
+    double InitIntegralWithLog(double min, double max, const std::function<double(double)>& integrand);
 
     //----------------------------------------------------------------------------//
 
@@ -475,7 +488,7 @@ private:
      * \param   function2use    integrand
      * \return  Integration result
      */
-    double IntegrateClosed(double min, double max, std::function<double(double)> integrand);
+    double IntegrateClosed(double min, double max, const std::function<double(double)>& integrand);
 
     //----------------------------------------------------------------------------//
 
@@ -488,7 +501,7 @@ private:
      * \param   function2use    integrand
      * \return  Integration result
      */
-    double IntegrateOpened(double min, double max, std::function<double(double)> integrand);
+    double IntegrateOpened(double min, double max, const std::function<double(double)>& integrand);
 
     //----------------------------------------------------------------------------//
 
@@ -504,7 +517,7 @@ private:
 
     double IntegrateWithSubstitution(double min,
                                      double max,
-                                     std::function<double(double)> integrand,
+                                     const std::function<double(double)>& integrand,
                                      double powerOfSubstitution);
 
     //----------------------------------------------------------------------------//
@@ -518,7 +531,7 @@ private:
      * \return  Integration result
      */
 
-    double IntegrateWithLog(double min, double max, std::function<double(double)> integrand);
+    double IntegrateWithLog(double min, double max, const std::function<double(double)>& integrand);
 
     //----------------------------------------------------------------------------//
 
@@ -534,7 +547,7 @@ private:
 
     double IntegrateWithLogSubstitution(double min,
                                         double max,
-                                        std::function<double(double)> integrand,
+                                        const std::function<double(double)>& integrand,
                                         double powerOfSubstitution);
 
     //----------------------------------------------------------------------------//
@@ -549,7 +562,7 @@ private:
      * \return  Integration result
      */
 
-    double IntegrateWithLog(double min, double max, std::function<double(double)> integrand, double randomRatio);
+    double IntegrateWithLog(double min, double max, const std::function<double(double)>& integrand, double randomRatio);
 
     //----------------------------------------------------------------------------//
 
@@ -567,7 +580,7 @@ private:
 
     double IntegrateWithSubstitution(double min,
                                      double max,
-                                     std::function<double(double)> integrand,
+                                     const std::function<double(double)>& integrand,
                                      double powerOfSubstitution,
                                      double randomRatio);
 };
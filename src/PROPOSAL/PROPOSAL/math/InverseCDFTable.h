@@ -0,0 +1,61 @@
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace PROPOSAL {
+/*!
+ * Tabulated inverse of a cumulative distribution in y, which depends on two
+ * further parameters e and x.
+ *
+ * All three variables are scaled to the unit interval by the user. For every
+ * node (e, x) the density is integrated on an equidistant grid in y and the
+ * cumulative distribution is inverted at the quantile nodes. Evaluation
+ * interpolates linearly in e, x and the quantile, so sampling from the
+ * distribution needs neither an integration nor a root finding. Nodes where
+ * the density vanishes on the whole y range take the quantiles of the closest
+ * node in x. If there is none, zero is returned.
+ *
+ * The accuracy depends on the distribution, the parametrizations using the
+ * table state theirs.
+ */
+class InverseCDFTable {
+public:
+    struct Definition {
+        std::function<double(double e, double x, double y)> pdf;
+        unsigned int nodes_e = 100;
+        unsigned int nodes_x = 50;
+        unsigned int nodes_y = 1000;
+        unsigned int nodes_quantile = 100;
+        //! place the nodes in x and in the quantile denser towards both ends
+        //! of the unit interval, where distributions close to a kinematic
+        //! limit and their tails change fastest
+        bool dense_ends = false;
+    };
+
+    InverseCDFTable(const Definition&);
+
+    /*!
+     * Returns y with P(y' < y | e, x) = rnd. Arguments outside of the unit
+     * interval are clamped.
+     */
+    double Evaluate(double e, double x, double rnd) const;
+
+private:
+    unsigned int nodes_e;
+    unsigned int nodes_x;
+    unsigned int nodes_quantile;
+    bool dense_ends;
+    std::vector<double> quantiles; // [e][x][quantile]
+
+    void FillEmptyNodes(unsigned int i, const std::vector<bool>& valid);
+};
+
+/*!
+ * Returns the table for the given definition. Tables are shared between all
+ * callers requesting the same hash and only built once per process.
+ */
+std::shared_ptr<const InverseCDFTable> make_inverse_cdf_table(
+    const InverseCDFTable::Definition&, size_t hash);
+} // namespace PROPOSAL
@@ -183,6 +183,22 @@ double SampleFromGaussian(double mean, double sigma, double rnd,
                           double min = -INF,
                           double max = INF);
 
+/// @brief          Sample a value from a truncated normal distribution like
+///                 SampleFromGaussian, but with the percent point function
+///                 read from a table. Limits more than eight sigma away from
+///                 the mean truncate the distribution by less than 1e-15 and
+///                 are ignored, so in most cases no error function has to be
+///                 evaluated.
+/// @param mean     Mean of the normal distribution
+/// @param sigma    Standard deviation of the normal distribution
+/// @param rnd      Random number used for sampling, needs to be between 0 and 1
+/// @param min      Lower limit where numbers should be sampled
+/// @param max      Upper limit where numbers should be sampled
+/// @return         Sampled value
+
+double SampleFromTruncatedGaussian(double mean, double sigma, double rnd,
+                                   double min, double max);
+
 
 /// @brief          Sample a value from exponential distribution with a given lambda 
 /// @param p        Random number between 0 and 1 for sampling 
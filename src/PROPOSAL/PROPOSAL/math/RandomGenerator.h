@@ -99,6 +99,15 @@ public:
      */
     virtual void SetDefaultRandomNumberGenerator();
 
+    /** @brief Set a random number generator for the calling thread only
+     *
+     * As long as it is set, RandomDouble called from this thread returns the
+     * numbers of this generator instead of the global one. An empty function
+     * resets the thread to the global generator. The global generator and
+     * other threads are not affected.
+     */
+    void SetThreadRandomNumberGenerator(std::function<double()> f);
+
 private:
     RandomGenerator();
     virtual ~RandomGenerator();
@@ -107,6 +116,7 @@ private:
 
     static std::mt19937 rng_;
     static std::uniform_real_distribution<double> uniform_distribution;
+    static thread_local std::function<double()> thread_random_function;
     std::function<double()> random_function;
 #ifdef ICECUBE_PROJECT
     I3RandomService* i3random_gen_;
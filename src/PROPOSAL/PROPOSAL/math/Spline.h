@@ -65,7 +65,15 @@ class Spline {
     virtual Spline* clone() const = 0;
 
     virtual bool save(std::string, bool);
-    virtual double evaluate(double x);
+    virtual double evaluate(double x) const;
+
+    /**
+     * Evaluates the spline, starting the search for the subintervall at
+     * segment. The segment containing x is written back, so consecutive
+     * evaluations at nearby arguments, e.g. along a track, only need a
+     * comparison with the neighbouring knots instead of a binary search.
+     */
+    double evaluate_with_hint(double x, unsigned int& segment) const;
     virtual void Derivative();
     virtual void Antiderivative(double c);
 
@@ -83,9 +91,17 @@ class Spline {
     virtual void calculate_splines(std::vector<double> x,
                                    std::vector<double> y) = 0;
 
+    // copies the coefficients of splines_ into coeff_, has to be called
+    // whenever splines_ is modified
+    void update_coefficients();
+    unsigned int find_segment(double x) const;
+
     std::vector<Polynom> splines_;
     std::vector<double> subintervall_;
     unsigned int n_subintervalls_;
+    // n_coeff_ coefficients per subintervall, in powers of x
+    std::vector<double> coeff_;
+    unsigned int n_coeff_;
     std::vector<double> x_;
     std::vector<double> y_;
 };
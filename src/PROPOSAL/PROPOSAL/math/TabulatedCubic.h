@@ -0,0 +1,57 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+namespace PROPOSAL {
+/*!
+ * Piecewise cubic interpolation of tabulated points.
+ *
+ * In every segment the cubic through the four closest points is used, which
+ * is the polynomial interpolation of order four of Interpolant. The
+ * coefficients of all segments are calculated once and stored in a flat
+ * array, so an evaluation is a binary search for the segment and one cubic
+ * polynomial. For equidistant points the segment is calculated directly.
+ * Outside of the points the first or last segment is extrapolated. Tables on
+ * the same points can share the segment of a value, so several functions are
+ * evaluated with a single search.
+ */
+class TabulatedCubic {
+    std::vector<double> x;
+    std::vector<double> coeff; // four per segment, in powers of (x - x_i)
+    double inverse_step;       // 1 / (x_i+1 - x_i) if equidistant, 0 otherwise
+
+public:
+    TabulatedCubic(std::vector<double> x, const std::vector<double>& y);
+
+    double operator()(double) const;
+    double operator()(double, size_t segment) const;
+
+    size_t FindSegment(double) const;
+
+    double GetLowerLimit() const noexcept { return x.front(); }
+    double GetUpperLimit() const noexcept { return x.back(); }
+};
+
+/*!
+ * Interpolation of a table where every node x1 has its own grid in x2, like
+ * the differential cross sections tabulated in v for every energy.
+ *
+ * Every row is a TabulatedCubic in x2. Between the rows the cubic through the
+ * four closest rows is used. The rows may cover different ranges in x2, e.g.
+ * if the lower kinematic limit depends on x1. The range at x1 is
+ * interpolated as well and every row is evaluated at the same relative
+ * position in its own range, so the limits of all rows are aligned.
+ */
+class TabulatedCubic2D {
+    std::vector<double> x1;
+    std::vector<TabulatedCubic> rows;
+
+public:
+    TabulatedCubic2D(std::vector<double> x1,
+        const std::vector<std::vector<double>>& x2,
+        const std::vector<std::vector<double>>& y);
+
+    double operator()(double x1, double x2) const;
+};
+} // namespace PROPOSAL
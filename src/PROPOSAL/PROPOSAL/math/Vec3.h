@@ -0,0 +1,119 @@
+#pragma once
+#include "PROPOSAL/math/Vector3D.h"
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <type_traits>
+#include <utility>
+
+namespace PROPOSAL {
+/*!
+ * Plain cartesian three-vector for the internal propagation math.
+ *
+ * In contrast to Cartesian3D, Vec3 has no virtual functions. It is trivially
+ * copyable, can be passed in registers and arrays of Vec3 are contiguous
+ * x, y, z triples. Cartesian3D and Spherical3D remain the types of the
+ * public interface, conversions are possible in both directions.
+ */
+struct Vec3 {
+    double x;
+    double y;
+    double z;
+
+    Vec3() = default;
+    constexpr Vec3(double x, double y, double z) : x(x), y(y), z(z) {};
+    constexpr Vec3(const std::array<double, 3>& c) : x(c[0]), y(c[1]), z(c[2]) {};
+    explicit Vec3(const Vector3D& v) : Vec3(v.GetCartesianCoordinates()) {};
+
+    std::array<double, 3> GetCartesianCoordinates() const { return { x, y, z }; }
+
+    Vec3 operator-() const { return { -x, -y, -z }; }
+    Vec3& operator+=(const Vec3& rhs)
+    {
+        x += rhs.x;
+        y += rhs.y;
+        z += rhs.z;
+        return *this;
+    }
+
+    double magnitude() const { return std::sqrt(x * x + y * y + z * z); }
+    void normalize()
+    {
+        auto length = magnitude();
+        x /= length;
+        y /= length;
+        z /= length;
+    }
+
+    /*!
+     * Unit vectors (e1, e2) perpendicular to this unit vector, such that
+     * (e1, e2, *this) is a right-handed orthonormal basis. The construction
+     * of Duff et al., J. Comput. Graph. Tech. 6 (2017) 1, has no branches
+     * and no trigonometric functions and is continuous except at -z. For
+     * the z-axis, e1 and e2 are the x- and y-axis.
+     */
+    std::pair<Vec3, Vec3> GetOrthonormalBasis() const
+    {
+        auto sign = std::copysign(1., z);
+        auto a = -1. / (sign + z);
+        auto b = x * y * a;
+        return { Vec3(1. + sign * x * x * a, sign * b, -sign * x),
+            Vec3(b, sign + y * y * a, -y) };
+    }
+
+    /*!
+     * Rotates the vector by the polar angle with cosine cosphi_deflect and
+     * the azimuth angle theta_deflect, analogous to Cartesian3D::deflect.
+     */
+    void deflect(double cosphi_deflect, double theta_deflect)
+    {
+        if (cosphi_deflect == 1 && theta_deflect == 0)
+            return;
+        auto sinphi_deflect = std::sqrt(std::max(
+            0., (1. - cosphi_deflect) * (1. + cosphi_deflect)));
+        auto tx = sinphi_deflect * std::cos(theta_deflect);
+        auto ty = sinphi_deflect * std::sin(theta_deflect);
+        auto tz = std::sqrt(std::max(1. - tx * tx - ty * ty, 0.));
+        if (cosphi_deflect < 0.)
+            tz = -tz; // Backward deflection
+
+        auto basis = GetOrthonormalBasis();
+        x = tz * x + tx * basis.first.x + ty * basis.second.x;
+        y = tz * y + tx * basis.first.y + ty * basis.second.y;
+        z = tz * z + tx * basis.first.z + ty * basis.second.z;
+    }
+};
+
+inline Vec3 operator+(const Vec3& lhs, const Vec3& rhs)
+{
+    return { lhs.x + rhs.x, lhs.y + rhs.y, lhs.z + rhs.z };
+}
+
+inline Vec3 operator-(const Vec3& lhs, const Vec3& rhs)
+{
+    return { lhs.x - rhs.x, lhs.y - rhs.y, lhs.z - rhs.z };
+}
+
+inline double operator*(const Vec3& lhs, const Vec3& rhs)
+{
+    return lhs.x * rhs.x + lhs.y * rhs.y + lhs.z * rhs.z;
+}
+
+inline Vec3 operator*(const Vec3& lhs, double val)
+{
+    return { lhs.x * val, lhs.y * val, lhs.z * val };
+}
+
+inline Vec3 operator*(double val, const Vec3& rhs) { return rhs * val; }
+
+inline Vec3 vector_product(const Vec3& lhs, const Vec3& rhs)
+{
+    return { lhs.y * rhs.z - lhs.z * rhs.y, lhs.z * rhs.x - lhs.x * rhs.z,
+        lhs.x * rhs.y - lhs.y * rhs.x };
+}
+
+static_assert(std::is_trivially_copyable<Vec3>::value,
+    "Vec3 must be trivially copyable.");
+static_assert(sizeof(Vec3) == 3 * sizeof(double),
+    "Vec3 must be a packed triple of doubles.");
+} // namespace PROPOSAL
@@ -6,6 +6,7 @@
 namespace PROPOSAL {
 class Displacement;
 struct CrossSectionBase;
+class TabulatedCubic;
 }
 
 namespace PROPOSAL {
@@ -31,6 +32,18 @@ struct ContRand {
 
     auto GetHash() const noexcept { return hash; }
 
+protected:
+    // Only in the interpolated case: variance integral from the lower energy
+    // limit and its integrand, tabulated in log(E) like the grammage of the
+    // exact time. The integrand is used for steps too short to take the
+    // difference.
+    std::shared_ptr<const TabulatedCubic> cumulative_variance;
+    std::shared_ptr<const TabulatedCubic> variance_integrand;
+
+    void BuildVarianceTables();
+    bool InVarianceTables(double initial_energy) const noexcept;
+    double TabulatedVariance(double initial_energy, double final_energy) const;
+
 private:
     void CalculateHash() noexcept;
 };
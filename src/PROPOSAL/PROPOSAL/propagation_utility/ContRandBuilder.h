@@ -23,6 +23,8 @@ public:
     inline double Variance(double initial_energy, double final_energy) final
     {
         assert(initial_energy >= final_energy);
+        if (InVarianceTables(initial_energy))
+            return TabulatedVariance(initial_energy, final_energy);
         return cont_rand_integral.Calculate(initial_energy, final_energy);
     }
 
@@ -32,9 +34,11 @@ public:
         auto std = std::sqrt(Variance(initial_energy, final_energy));
         // the parameter 'min' passed to SampleFromGaussian has been
         // min(disp->GetLowerLim(), final_energy) before min_energy was added
-        return SampleFromGaussian(final_energy, std, rnd,
-                                  std::max(disp->GetLowerLim(), min_energy),
-                                  initial_energy);
+        auto min = std::max(disp->GetLowerLim(), min_energy);
+        if (cumulative_variance)
+            return SampleFromTruncatedGaussian(
+                final_energy, std, rnd, min, initial_energy);
+        return SampleFromGaussian(final_energy, std, rnd, min, initial_energy);
     }
 };
 
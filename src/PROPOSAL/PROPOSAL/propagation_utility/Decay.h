@@ -1,5 +1,6 @@
 #pragma once
 #include "PROPOSAL/math/InterpolantBuilder.h"
+#include <vector>
 
 namespace PROPOSAL {
     class Displacement;
@@ -20,6 +21,10 @@ public:
     virtual ~Decay() = default;
 
     virtual double EnergyDecay(double, double, double) = 0;
+    // EnergyDecay for every element, with a single virtual call
+    virtual void EnergyDecay(const std::vector<double>& energy,
+        const std::vector<double>& rnd, const std::vector<double>& density,
+        std::vector<double>& decay_energy);
     double FunctionToIntegral(double energy);
 
     auto GetHash() const noexcept { return hash; }
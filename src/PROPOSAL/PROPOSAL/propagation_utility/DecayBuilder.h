@@ -17,6 +17,9 @@ public:
     DecayBuilder(disp_ptr, double, double, std::false_type);
 
     double EnergyDecay(double energy, double rnd, double density) override;
+    void EnergyDecay(const std::vector<double>& energy,
+        const std::vector<double>& rnd, const std::vector<double>& density,
+        std::vector<double>& decay_energy) override;
 };
 
 std::unique_ptr<Decay> make_decay(
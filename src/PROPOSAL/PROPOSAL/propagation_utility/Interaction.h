@@ -28,6 +28,9 @@ public:
     virtual ~Interaction() = default;
 
     virtual double EnergyInteraction(double, double) = 0;
+    // EnergyInteraction for every element, with a single virtual call
+    virtual void EnergyInteraction(const std::vector<double>& energy,
+        const std::vector<double>& rnd, std::vector<double>& interaction_energy);
     virtual double EnergyIntegral(double, double) = 0;
     double FunctionToIntegral(double) const;
 
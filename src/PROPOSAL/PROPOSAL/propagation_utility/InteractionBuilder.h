@@ -30,6 +30,9 @@ public:
         crosssection_list_t const&, std::true_type, bool);
 
     double EnergyInteraction(double energy, double rnd) final;
+    void EnergyInteraction(const std::vector<double>& energy,
+        const std::vector<double>& rnd,
+        std::vector<double>& interaction_energy) final;
     double EnergyIntegral(double E_i, double E_f) final;
 
     double MeanFreePath(double energy) final;
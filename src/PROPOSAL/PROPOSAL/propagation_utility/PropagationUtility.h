@@ -33,6 +33,7 @@
 #include <memory>
 #include <tuple>
 #include <functional>
+#include <utility>
 
 namespace PROPOSAL {
 class Component;
@@ -69,11 +70,27 @@ public:
     Interaction::Loss EnergyStochasticloss(double, double);
     double EnergyDecay(double, std::function<double()>, double);
     double EnergyInteraction(double, std::function<double()>);
+
+    // next interaction energies of several particles in the same sector,
+    // the random numbers are drawn beforehand by the caller
+    void EnergyDecay(const std::vector<double>& energy,
+        const std::vector<double>& rnd, const std::vector<double>& density,
+        std::vector<double>& decay_energy);
+    void EnergyInteraction(const std::vector<double>& energy,
+        const std::vector<double>& rnd, std::vector<double>& interaction_energy);
     double EnergyRandomize(double, double, std::function<double()>, double);
     double EnergyDistance(double, double);
     double LengthContinuous(double, double);
     double TimeElapsed(double, double, double, double);
 
+    // grammage and elapsed time of a continuous step, looked up together if
+    // the time calculator tabulates both
+    std::pair<double, double> LengthAndTimeContinuous(double, double, double);
+    void LengthAndTimeContinuous(const std::vector<double>& initial_energy,
+        const std::vector<double>& final_energy,
+        const std::vector<double>& density, std::vector<double>& grammage,
+        std::vector<double>& time);
+
     // TODO: return value doesn't tell what it include. Maybe it would be better
     // to give a tuple of two directions back. One is the mean over the
     // displacement and the other is the actual direction. With a get method
@@ -1,6 +1,8 @@
 #pragma once
 
 #include "PROPOSAL/math/InterpolantBuilder.h"
+#include <utility>
+#include <vector>
 
 namespace PROPOSAL {
     class Displacement;
@@ -20,5 +22,19 @@ public:
     virtual ~Time() = default;
 
     virtual double TimeElapsed(double, double, double, double) = 0;
+
+    /*!
+     * Grammage and elapsed time of a continuous step from initial_energy to
+     * final_energy. By default the grammage is calculated by the displacement
+     * and passed to TimeElapsed. Builders which tabulate both integrals
+     * evaluate them with a single lookup.
+     */
+    virtual std::pair<double, double> GrammageAndTimeElapsed(Displacement&,
+        double initial_energy, double final_energy, double local_density);
+    virtual void GrammageAndTimeElapsed(Displacement&,
+        const std::vector<double>& initial_energy,
+        const std::vector<double>& final_energy,
+        const std::vector<double>& local_density,
+        std::vector<double>& grammage, std::vector<double>& time);
 };
 }
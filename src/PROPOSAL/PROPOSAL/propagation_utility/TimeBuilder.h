@@ -5,11 +5,25 @@
 #include <memory>
 
 namespace PROPOSAL {
+class TabulatedCubic;
+
 class ExactTimeBuilder : public Time {
     std::shared_ptr<Displacement> disp;
     size_t hash;
     std::shared_ptr<UtilityIntegral> time_integral;
 
+    // Only in the interpolated case: grammage and time integral from the
+    // lower energy limit and their integrands, tabulated on the same grid in
+    // log(E), so both are evaluated with one segment search. The integrands
+    // are used for steps too short to take the difference.
+    std::shared_ptr<const TabulatedCubic> cumulative_grammage;
+    std::shared_ptr<const TabulatedCubic> cumulative_time;
+    std::shared_ptr<const TabulatedCubic> grammage_integrand;
+    std::shared_ptr<const TabulatedCubic> time_integrand;
+
+    void BuildTables();
+    bool InTables(double initial_energy) const noexcept;
+
 public:
     ExactTimeBuilder(
         std::shared_ptr<Displacement>, double mass, std::false_type);
@@ -19,6 +33,16 @@ public:
     double FunctionToIntegral(double energy);
     double TimeElapsed(double initial_energy, double final_energy,
         double grammage, double local_density) override;
+    using Time::GrammageAndTimeElapsed;
+    /*!
+     * Within the tables, the grammage is taken from the tabulated integral of
+     * the displacement passed at construction and the Displacement argument
+     * is ignored. It is only used above the upper energy limit of the tables
+     * and without interpolation.
+     */
+    std::pair<double, double> GrammageAndTimeElapsed(Displacement&,
+        double initial_energy, double final_energy,
+        double local_density) override;
     auto GetHash() const noexcept { return hash; }
 };
 
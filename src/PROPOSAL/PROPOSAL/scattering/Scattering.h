@@ -6,8 +6,9 @@
 #include "PROPOSAL/scattering/stochastic_deflection/Parametrization.h"
 #include "PROPOSAL/scattering/stochastic_deflection/ScatteringFactory.h"
 
+#include <array>
 #include <memory>
-#include <unordered_map>
+#include <stdexcept>
 #include <vector>
 
 namespace PROPOSAL {
@@ -19,19 +20,44 @@ namespace PROPOSAL {
 class Scattering {
 
     using deflect_ptr = std::unique_ptr<stochastic_deflection::Parametrization>;
-    using deflect_map_t = std::unordered_map<InteractionType, deflect_ptr,
-        InteractionType_hash>;
     using scatter_ptr = std::unique_ptr<multiple_scattering::Parametrization>;
 
+    // InteractionType::Undefined and the types from InteractionType::Particle
+    // to InteractionType::Photoeffect.
+    static constexpr size_t n_types = 17;
+    static_assert(static_cast<int>(InteractionType::Photoeffect)
+                - static_cast<int>(InteractionType::Particle) + 2 == n_types,
+        "n_types does not cover all interaction types.");
+    using deflect_array_t = std::array<deflect_ptr, n_types>;
+
+    /**
+     * @brief Position of the deflection of an interaction type in the
+     * deflection array. Unknown types are mapped to the slot of
+     * InteractionType::Undefined, which is never occupied.
+     */
+    static size_t type_index(InteractionType t) noexcept
+    {
+        auto i = static_cast<int>(t) - static_cast<int>(InteractionType::Particle) + 1;
+        return (i > 0 && i < static_cast<int>(n_types)) ? i : 0;
+    }
+
     scatter_ptr m_scatter_ptr;
-    deflect_map_t stochastic_deflection;
+    deflect_array_t stochastic_deflection;
 
     template <typename T> inline auto init_deflection(T&& obj)
     {
-        auto m = deflect_map_t();
-        for (auto&& d : obj)
-            m[d->GetInteractionType()] = std::move(d);
-        return m;
+        auto a = deflect_array_t();
+        for (auto&& d : obj) {
+            if (d->RequiredRandomNumbers() > stochastic_deflection::MAX_RANDOM_NUMBERS)
+                throw std::invalid_argument("Stochastic deflection requires more "
+                                            "random numbers than provided.");
+            auto idx = type_index(d->GetInteractionType());
+            if (idx == 0)
+                throw std::invalid_argument("Stochastic deflection of undefined "
+                                            "interaction type.");
+            a[idx] = std::move(d);
+        }
+        return a;
     }
 
     template <typename T> inline auto init_deflection(T const& ref)
@@ -109,9 +135,9 @@ public:
      */
     size_t StochasticDeflectionRandomNumbers(InteractionType t) const noexcept
     {
-        auto it = stochastic_deflection.find(t);
-        if (it != stochastic_deflection.end())
-            return it->second->RequiredRandomNumbers();
+        auto& d = stochastic_deflection[type_index(t)];
+        if (d)
+            return d->RequiredRandomNumbers();
         return 0;
     }
 
@@ -136,9 +162,9 @@ public:
     UnitSphericalVector CalculateStochasticDeflection(
         InteractionType t, Args... args)
     {
-        auto it = stochastic_deflection.find(t);
-        if (it != stochastic_deflection.end())
-            return _stochastic_deflect(*it->second, args...);
+        auto& d = stochastic_deflection[type_index(t)];
+        if (d)
+            return _stochastic_deflect(*d, args...);
         auto new_dir = UnitSphericalVector(0, 0);
         return new_dir;
     }
@@ -159,7 +185,7 @@ public:
 
 template <> inline auto Scattering::init_deflection(std::nullptr_t&&)
 {
-    return Scattering::deflect_map_t();
+    return Scattering::deflect_array_t();
 }
 
 template <> inline auto Scattering::init_multiple_scatter(std::nullptr_t&&)
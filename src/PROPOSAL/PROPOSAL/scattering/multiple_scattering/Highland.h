@@ -32,6 +32,7 @@
 #include "PROPOSAL/particle/ParticleDef.h"
 #include "PROPOSAL/scattering/multiple_scattering/Parametrization.h"
 #include <array>
+#include <vector>
 
 /**
  * \brief This class provides the scattering routine provided by moliere.
@@ -59,6 +60,19 @@ namespace multiple_scattering {
         ScatteringOffset CalculateRandomAngle(double grammage, double ei,
             double ef, const std::array<double, 4>& rnd) override;
         virtual double CalculateTheta0(double grammage, double ei, double ef);
+
+        /*!
+         * Same as the single step versions for a bundle of steps, e.g. one
+         * step of every particle propagated in lock-step. The i-th result
+         * belongs to the i-th step.
+         */
+        std::vector<ScatteringOffset> CalculateRandomAngle(
+            const std::vector<double>& grammage, const std::vector<double>& ei,
+            const std::vector<double>& ef,
+            const std::vector<std::array<double, 4>>& rnd);
+        virtual void CalculateTheta0(const std::vector<double>& grammage,
+            const std::vector<double>& ei, const std::vector<double>& ef,
+            std::vector<double>& theta0);
     };
 } // namespace multiple_scattering
 
@@ -33,6 +33,7 @@
 namespace PROPOSAL {
     class Displacement;
     struct CrossSectionBase;
+    class TabulatedCubic;
     class UtilityIntegral;
 }
 
@@ -41,7 +42,15 @@ namespace multiple_scattering {
     class HighlandIntegral : public Highland {
         std::shared_ptr<UtilityIntegral> highland_integral;
 
+        // Only in the interpolated case: integral from the energy to
+        // UPPER_ENERGY_LIM and the integrand, both tabulated in log(E).
+        // The integrand is used for steps too short to take the difference.
+        std::shared_ptr<const TabulatedCubic> cumulative_integral;
+        std::shared_ptr<const TabulatedCubic> integrand;
+
         inline double Integral(Displacement&, double);
+        double CalculateIntegral(double ei, double ef);
+        double Theta0FromIntegral(double grammage, double integral) const;
 
     public:
         HighlandIntegral(const ParticleDef& p, Medium const& m,
@@ -56,6 +65,9 @@ namespace multiple_scattering {
         }
 
         double CalculateTheta0(double, double, double) final;
+        void CalculateTheta0(const std::vector<double>& grammage,
+            const std::vector<double>& ei, const std::vector<double>& ef,
+            std::vector<double>& theta0) final;
     };
 } // namespace multiple_scattering
 
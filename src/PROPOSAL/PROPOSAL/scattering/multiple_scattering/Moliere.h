@@ -29,8 +29,10 @@
 #pragma once
 
 #include <array>
+#include <memory>
 #include <vector>
 
+#include "PROPOSAL/math/InverseCDFTable.h"
 #include "PROPOSAL/medium/Medium.h"
 #include "PROPOSAL/scattering/multiple_scattering/Parametrization.h"
 
@@ -62,6 +64,12 @@ namespace multiple_scattering {
         double chiCSq_; // characteristic angle² in rad²
         std::vector<double> B_;
 
+        // inverse cdf of the reduced angle |theta| / sqrt(chi_c^2 B) in 1/B
+        // and beta^2, where B is the one of the component with maximum weight
+        std::shared_ptr<const InverseCDFTable> angle_table_;
+
+        std::vector<double> CalculateB(double B, double beta_Sq) const;
+
         double f1M(double x);
         double f2M(double x);
 
@@ -72,11 +80,15 @@ namespace multiple_scattering {
 
         double F(double theta);
 
-        double GetRandom(double pre_factor, double rnd);
+        double GetRandom(double pre_factor, double beta_Sq, double rnd);
 
     public:
-        // constructor
-        Moliere(const ParticleDef&, Medium const&);
+        /*!
+         * If interpolate is true, the angles are sampled from a table of the
+         * inverse cumulative distribution built once per medium. Otherwise
+         * the distribution is inverted by Newton's method for every angle.
+         */
+        Moliere(const ParticleDef&, Medium const&, bool interpolate = true);
 
         ScatteringOffset CalculateRandomAngle(double grammage, double ei,
             double ef, const std::array<double, 4>& rnd) override;
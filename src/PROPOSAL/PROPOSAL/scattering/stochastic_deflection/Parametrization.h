@@ -13,6 +13,14 @@ using PROPOSAL::Component;
 
 namespace PROPOSAL {
 namespace stochastic_deflection {
+    /**
+     * @brief Upper bound of the random numbers a deflection may require. The
+     * random numbers are passed in a fixed size array, so sampling a
+     * deflection does not need any allocation.
+     */
+    static constexpr size_t MAX_RANDOM_NUMBERS = 2;
+    using RandomNumbers = std::array<double, MAX_RANDOM_NUMBERS>;
+
     struct Parametrization {
         Parametrization() = default;
         virtual ~Parametrization() = default;
@@ -23,8 +31,7 @@ namespace stochastic_deflection {
         virtual InteractionType GetInteractionType() const noexcept = 0;
         virtual UnitSphericalVector CalculateStochasticDeflection(
             double initial_energy, double final_energy,
-            std::vector<double> const&, size_t component) const = 0;
-            
+            RandomNumbers const&, size_t component) const = 0;
     };
 
     template <typename T>
@@ -0,0 +1,47 @@
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace PROPOSAL {
+namespace stochastic_deflection {
+    /*!
+     * Tabulated rms deflection angle of the Ginneken parametrizations as a
+     * function of the initial energy e_i and the relative energy loss nu.
+     *
+     * The logarithm of the rms angle is tabulated on an equidistant grid in
+     * log(e_i) and log(nu / (1 - nu)) and interpolated bilinearly, so an
+     * evaluation needs two logarithms and one exponential instead of the
+     * non-integer powers and root finding of the parametrization. Nodes where
+     * the parametrization is not defined or not positive are marked as
+     * invalid, as well as cells where the interpolation deviates by more than
+     * one percent from the parametrization, e.g. at a change of the rms
+     * formula. There and outside of the grid NaN is returned and the caller
+     * has to evaluate the parametrization itself.
+     */
+    class RmsThetaTable {
+    public:
+        using rms_theta_t = std::function<double(double e_i, double nu)>;
+
+        RmsThetaTable(const rms_theta_t&, double e_min, double e_max);
+
+        double operator()(double e_i, double nu) const noexcept;
+
+    private:
+        double log_e_min;
+        unsigned int nodes_e;
+        std::vector<float> log_rms_theta; // [e][nu]
+        std::vector<bool> direct_cells;   // [e][nu], not interpolated
+    };
+
+    /*!
+     * Returns the table of the rms angle for the energy range [e_min, e_max].
+     * Tables are shared between all callers requesting the same hash and only
+     * built once per process.
+     */
+    std::shared_ptr<const RmsThetaTable> make_rms_theta_table(
+        const RmsThetaTable::rms_theta_t&, double e_min, double e_max,
+        size_t hash);
+} // namespace stochastic_deflection
+} // namespace PROPOSAL
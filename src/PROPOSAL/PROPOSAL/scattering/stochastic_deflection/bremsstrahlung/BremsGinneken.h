@@ -1,6 +1,9 @@
 #pragma once 
 
 #include "PROPOSAL/scattering/stochastic_deflection/bremsstrahlung/Bremsstrahlung.h"
+#include "PROPOSAL/scattering/stochastic_deflection/RmsThetaTable.h"
+
+#include <utility>
 
 namespace PROPOSAL {
 namespace stochastic_deflection {
@@ -8,6 +11,9 @@ namespace stochastic_deflection {
                     { 
         static constexpr int n_rnd = 2;
         double mass;
+        // tabulated rms angle for the hash of every component of the medium
+        std::vector<std::pair<size_t, std::shared_ptr<const RmsThetaTable>>>
+            rms_theta_tables;
 
         std::unique_ptr<Parametrization> clone() const final 
         { 
@@ -16,15 +22,15 @@ namespace stochastic_deflection {
 
         double f_nu_g(double, double, double) const;
         double get_nu_g(double, double) const;
-        double get_rms_theta(double, double, double, double) const;
+        double get_rms_theta(double, double, double) const;
 
     public: 
-        BremsGinneken(const ParticleDef& p_def, const Medium&) : mass(p_def.mass) {};
+        BremsGinneken(const ParticleDef& p_def, const Medium&);
 
         size_t RequiredRandomNumbers() const noexcept final { return n_rnd; }
 
         UnitSphericalVector CalculateStochasticDeflection(
-            double e_i, double e_f, std::vector<double> const& rnd, size_t component) const final;
+            double e_i, double e_f, RandomNumbers const& rnd, size_t component) const final;
     };
 } // namespace stochastic_deflection 
 } // namespace PROPOSAL
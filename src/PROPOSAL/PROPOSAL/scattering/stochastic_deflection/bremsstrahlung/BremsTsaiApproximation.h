@@ -22,7 +22,7 @@ namespace stochastic_deflection {
         size_t RequiredRandomNumbers() const noexcept final { return n_rnd; }
 
         UnitSphericalVector CalculateStochasticDeflection(
-            double e_i, double e_f, std::vector<double> const& rnd, size_t) const final;
+            double e_i, double e_f, RandomNumbers const& rnd, size_t) const final;
     };
 } // namespace stochastic_deflection
 } // namespace PROPOSAL
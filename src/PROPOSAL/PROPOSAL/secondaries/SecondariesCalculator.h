@@ -53,6 +53,15 @@ public:
         secondary_generator[p->GetInteractionType()] = std::move(p);
     }
 
+    //!
+    //! Returns true if a parametrization for the interaction type is
+    //! available.
+    //!
+    inline bool HasInteraction(InteractionType type) const noexcept
+    {
+        return secondary_generator.find(type) != secondary_generator.end();
+    }
+
     //!
     //! Returns number required for calculation of a specific interactiontype.
     //!
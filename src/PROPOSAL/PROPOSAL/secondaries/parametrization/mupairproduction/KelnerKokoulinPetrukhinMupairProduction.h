@@ -2,6 +2,7 @@
 
 #include "PROPOSAL/crosssection/parametrization/MupairProduction.h"
 #include "PROPOSAL/math/Integral.h"
+#include "PROPOSAL/math/InverseCDFTable.h"
 #include "PROPOSAL/medium/Medium.h"
 #include "PROPOSAL/secondaries/parametrization/mupairproduction/MupairProduction.h"
 
@@ -15,14 +16,26 @@ namespace secondaries {
         Integral integral;
         ParticleDef p_def;
 
+        // inverse cdf of rho / rho_max in log(E) and log(v), key is the
+        // component hash
+        std::unordered_map<size_t, std::shared_ptr<const InverseCDFTable>>
+            rho_tables;
+        double lower_energy_lim;
+
         static constexpr int n_rnd = 3;
 
     public:
+        /*!
+         * If interpolate is true, rho is sampled from tables built for all
+         * components of the medium. Otherwise the rho distribution is
+         * integrated for every secondary.
+         *
+         * Above 3 GeV and away from the kinematic limits of v, the tabulated
+         * rho agrees with the integrated one for the same random number to
+         * 5e-3.
+         */
         KelnerKokoulinPetrukhinMupairProduction(
-            const ParticleDef& p, const Medium&)
-            : p_def(p)
-        {
-        }
+            const ParticleDef&, const Medium&, bool interpolate = true);
 
         double CalculateRho(double, double, const Component&, double, double) final;
         std::tuple<Cartesian3D, Cartesian3D> CalculateDirections(
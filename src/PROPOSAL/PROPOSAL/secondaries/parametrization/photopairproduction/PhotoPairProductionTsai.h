@@ -3,6 +3,7 @@
 #include "PROPOSAL/secondaries/parametrization/photopairproduction/PhotoPairProductionInterpolant.h"
 #include "PROPOSAL/crosssection/parametrization/PhotoPairProduction.h"
 #include "PROPOSAL/math/Integral.h"
+#include "PROPOSAL/math/InverseCDFTable.h"
 
 namespace PROPOSAL {
 namespace secondaries {
@@ -21,10 +22,28 @@ namespace secondaries {
     double FunctionToIntegral(double energy, double x, double theta,
                               const Component&);
 
+    // inverse cdf of the substituted polar angle in log(E) and the energy
+    // fraction x, key is the component hash
+    std::unordered_map<size_t, std::shared_ptr<const InverseCDFTable>>
+        theta_tables;
+    double lower_energy_lim = 0;
+
+    double SampleSubstitutedTheta(double energy, double x,
+        const Component&, double rnd);
+
     public:
         PhotoPairProductionTsai() = default;
-        PhotoPairProductionTsai(ParticleDef p, Medium m)
-            : PhotoPairProductionTsaiForwardPeaked(p, m) {}
+        /*!
+         * If interpolate is true, the angles are sampled from tables built
+         * for all components of the medium. Otherwise the angular
+         * distribution is integrated for every secondary.
+         *
+         * Above 30 MeV and away from the kinematic limits of x, the
+         * substituted angle theta^(1 / subst) / pi^(1 / subst), with
+         * subst = max(1, log10(E)), agrees with the integrated one for the
+         * same random number to 5e-3.
+         */
+        PhotoPairProductionTsai(ParticleDef p, Medium m, bool interpolate = true);
 
         std::tuple<Cartesian3D, Cartesian3D> CalculateDirections(
                 const Vector3D&, double, double, const Component&,
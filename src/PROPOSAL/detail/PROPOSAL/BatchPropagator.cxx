@@ -0,0 +1,198 @@
+#include "PROPOSAL/BatchPropagator.h"
+#include "PROPOSAL/density_distr/density_distr.h"
+#include "PROPOSAL/geometry/Geometry.h"
+#include "PROPOSAL/math/RandomGenerator.h"
+#include "PROPOSAL/particle/ParticleDef.h"
+#include "PROPOSAL/propagation_utility/Displacement.h"
+#include <algorithm>
+
+using namespace PROPOSAL;
+using std::get;
+
+BatchPropagator::BatchPropagator(Propagator prop)
+    : propagator(std::move(prop))
+{
+}
+
+size_t BatchPropagator::SectorIndex(const Sector& sector) const
+{
+    auto& sectors = propagator.sector_list;
+    for (size_t i = 0; i < sectors.size(); ++i) {
+        if (get<Propagator::GEOMETRY>(sectors[i])
+            == get<Propagator::GEOMETRY>(sector))
+            return i;
+    }
+    return sectors.size();
+}
+
+bool BatchPropagator::UpdateSectorIndex(Lane& lane) const
+{
+    auto& sectors = propagator.sector_list;
+    if (lane.sector_idx < sectors.size()
+        && get<Propagator::GEOMETRY>(sectors[lane.sector_idx])
+            == get<Propagator::GEOMETRY>(lane.sector))
+        return false;
+    lane.sector_idx = SectorIndex(lane.sector);
+    return true;
+}
+
+void BatchPropagator::InteractionEnergies(std::vector<Lane>& lanes,
+    const std::vector<size_t>& bucket, double min_energy,
+    std::function<double()> rnd)
+{
+    auto& sector = lanes[bucket.front()].sector;
+    auto& utility = get<Propagator::UTILITY>(sector);
+    auto& density = get<Propagator::DENSITY_DISTR>(sector);
+    auto has_decay = static_cast<bool>(utility.collection.decay_calc);
+
+    // the random numbers are drawn in the same order as by Propagate
+    energy.clear();
+    local_density.clear();
+    rnd_decay.clear();
+    rnd_interaction.clear();
+    for (auto i : bucket) {
+        auto& state = lanes[i].state;
+        energy.push_back(state.energy);
+        local_density.push_back(density->Evaluate(state.position));
+        rnd_decay.push_back(has_decay ? rnd() : 0.);
+        rnd_interaction.push_back(rnd());
+    }
+
+    utility.EnergyDecay(energy, rnd_decay, local_density, decay_energy);
+    utility.EnergyInteraction(energy, rnd_interaction, interaction_energy);
+
+    auto lower_lim = std::max(
+        min_energy, utility.collection.displacement_calc->GetLowerLim());
+    for (size_t k = 0; k < bucket.size(); ++k) {
+        auto& lane = lanes[bucket[k]];
+        auto& energies = lane.interaction_energies;
+        energies[Propagator::MinimalE] = lower_lim;
+        energies[Propagator::Decay] = decay_energy[k];
+        energies[Propagator::Stochastic] = interaction_energy[k];
+        lane.next_interaction_type = propagator.maximize(energies);
+    }
+}
+
+std::vector<Secondaries> BatchPropagator::Propagate(
+    const std::vector<ParticleState>& initial_particles, double max_distance,
+    double min_energy, unsigned int hierarchy_condition)
+{
+    auto p_def = std::make_shared<ParticleDef>(propagator.p_def);
+    auto rnd
+        = std::bind(&RandomGenerator::RandomDouble, &RandomGenerator::Get());
+
+    auto tracks = std::vector<Secondaries>();
+    auto lanes = std::vector<Lane>();
+    tracks.reserve(initial_particles.size());
+    lanes.reserve(initial_particles.size());
+
+    // Active particles are kept in one bucket per sector. The index of the
+    // sector is only searched if a particle changes its sector.
+    auto buckets
+        = std::vector<std::vector<size_t>>(propagator.sector_list.size() + 1);
+    for (auto const& p : initial_particles) {
+        tracks.emplace_back(p_def, propagator.sector_list);
+        tracks.back().push_back(p, InteractionType::ContinuousEnergyLoss, 0);
+        auto sector = propagator.GetCurrentSector(p.position, p.direction);
+        auto sector_idx = SectorIndex(sector);
+        buckets[sector_idx].push_back(lanes.size());
+        lanes.push_back({ p, std::move(sector), sector_idx, {}, 0, 0 });
+    }
+
+    auto finished = std::vector<bool>(lanes.size(), false);
+    auto moved = std::vector<size_t>();
+    auto active = initial_particles.size();
+
+    while (active > 0) {
+        // Stage 1: energies of the next interactions, evaluated for all
+        // particles of a sector at once
+        for (auto const& bucket : buckets)
+            if (!bucket.empty())
+                InteractionEnergies(lanes, bucket, min_energy, rnd);
+
+        // Stage 2: continuous step, displacement and multiple scattering
+        for (auto const& bucket : buckets) {
+            for (auto i : bucket) {
+                auto& lane = lanes[i];
+                auto type = lane.next_interaction_type;
+                lane.advancement_type = propagator.AdvanceParticle(lane.state,
+                    lane.interaction_energies[type], max_distance, rnd,
+                    lane.sector, type == Propagator::MinimalE,
+                    lane.interaction_energies[Propagator::MinimalE]);
+                tracks[i].push_back(
+                    lane.state, InteractionType::ContinuousEnergyLoss, 0);
+            }
+        }
+
+        // Stage 3: stochastic losses, deflections and sector changes
+        for (auto const& bucket : buckets) {
+            for (auto i : bucket) {
+                auto& lane = lanes[i];
+                auto& utility = get<Propagator::UTILITY>(lane.sector);
+                switch (lane.advancement_type) {
+                case Propagator::ReachedInteraction:
+                    switch (lane.next_interaction_type) {
+                    case Propagator::Stochastic: {
+                        auto loss = propagator.DoStochasticInteraction(
+                            lane.state, utility, rnd);
+                        if (loss.type != InteractionType::Undefined)
+                            tracks[i].push_back(
+                                lane.state, loss.type, loss.comp_hash);
+                        if (lane.state.energy
+                            <= lane.interaction_energies[Propagator::MinimalE])
+                            finished[i] = true;
+                        break;
+                    }
+                    case Propagator::Decay:
+                        tracks[i].push_back(
+                            lane.state, InteractionType::Decay, 0);
+                        finished[i] = true;
+                        break;
+                    case Propagator::MinimalE:
+                        finished[i] = true;
+                        break;
+                    }
+                    break;
+                case Propagator::ReachedBorder: {
+                    auto hierarchy_i = get<Propagator::GEOMETRY>(lane.sector)
+                                           ->GetHierarchy();
+                    lane.sector = propagator.GetCurrentSector(
+                        lane.state.position, lane.state.direction);
+                    auto hierarchy_f = get<Propagator::GEOMETRY>(lane.sector)
+                                           ->GetHierarchy();
+                    if (hierarchy_i > hierarchy_condition
+                        && hierarchy_f < hierarchy_condition)
+                        finished[i] = true;
+                    break;
+                }
+                case Propagator::ReachedMaxDistance:
+                    finished[i] = true;
+                    break;
+                }
+            }
+        }
+
+        // Remove finished particles and move the ones which have changed
+        // their sector, either by a border crossing or by AdvanceParticle.
+        moved.clear();
+        for (auto& bucket : buckets) {
+            bucket.erase(std::remove_if(bucket.begin(), bucket.end(),
+                             [&](size_t i) {
+                                 if (finished[i]) {
+                                     --active;
+                                     return true;
+                                 }
+                                 if (UpdateSectorIndex(lanes[i])) {
+                                     moved.push_back(i);
+                                     return true;
+                                 }
+                                 return false;
+                             }),
+                bucket.end());
+        }
+        for (auto i : moved)
+            buckets[lanes[i].sector_idx].push_back(i);
+    }
+
+    return tracks;
+}
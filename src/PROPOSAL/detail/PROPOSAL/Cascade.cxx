@@ -0,0 +1,366 @@
+#include "PROPOSAL/Cascade.h"
+#include "PROPOSAL/crosssection/CrossSectionVector.h"
+#include "PROPOSAL/crosssection/ParticleDefaultCrossSectionList.h"
+#include "PROPOSAL/math/RandomGenerator.h"
+#include "PROPOSAL/medium/Components.h"
+#include "PROPOSAL/medium/Medium.h"
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <random>
+#include <thread>
+
+using namespace PROPOSAL;
+
+namespace {
+Component target_component(size_t hash)
+{
+    // Cross sections which are not calculated per component, like
+    // ionization, store the hash of the medium instead. Their secondaries do
+    // not depend on the component, so the first component of the medium is
+    // used.
+    try {
+        return Component::GetComponentForHash(hash);
+    } catch (const std::invalid_argument&) {
+        return Medium::GetMediumForHash(hash).GetComponents().front();
+    }
+}
+
+// Interactions the propagated particle survives. Their parametrizations
+// return the particle after the interaction as the first secondary.
+bool keeps_primary(InteractionType type)
+{
+    switch (type) {
+    case InteractionType::Brems:
+    case InteractionType::Ioniz:
+    case InteractionType::Epair:
+    case InteractionType::MuPair:
+    case InteractionType::Compton:
+        return true;
+    default:
+        return false;
+    }
+}
+
+// Seed of the n-th secondary of a particle, mixed with the splitmix64
+// finalizer so that the streams of siblings are uncorrelated.
+uint64_t child_seed(uint64_t seed, size_t n)
+{
+    auto z = seed + (n + 1) * 0x9e3779b97f4a7c15ULL;
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+    return z ^ (z >> 31);
+}
+
+// Draws the random numbers of the calling thread from its own stream as long
+// as it exists.
+class TaskRandomStream {
+    std::mt19937_64 engine;
+    std::uniform_real_distribution<double> uniform;
+
+public:
+    TaskRandomStream()
+        : uniform(0., 1.)
+    {
+        RandomGenerator::Get().SetThreadRandomNumberGenerator(
+            [this]() { return uniform(engine); });
+    }
+    TaskRandomStream(const TaskRandomStream&) = delete;
+    TaskRandomStream& operator=(const TaskRandomStream&) = delete;
+    ~TaskRandomStream()
+    {
+        RandomGenerator::Get().SetThreadRandomNumberGenerator(nullptr);
+    }
+
+    void seed(uint64_t seed)
+    {
+        engine.seed(seed);
+        uniform.reset();
+    }
+};
+} // namespace
+
+/*!
+ * One deque of tasks per worker. A worker takes the latest task from its own
+ * deque and steals the oldest task of another worker if its own deque is
+ * empty. The number of pending tasks includes tasks that are currently
+ * processed, since they can still produce new tasks. Idle workers sleep until
+ * a task is queued, all tasks are done or the queue is stopped.
+ */
+class Cascade::WorkQueue {
+    struct Deque {
+        std::mutex mutex;
+        std::deque<Task> tasks;
+    };
+
+    std::vector<Deque> queues;
+    std::atomic<size_t> pending;
+    std::atomic<size_t> queued;
+    bool stopped;
+    std::mutex wait_mutex;
+    std::condition_variable wake_up;
+
+public:
+    WorkQueue(size_t n_worker)
+        : queues(n_worker)
+        , pending(0)
+        , queued(0)
+        , stopped(false)
+    {
+    }
+
+    void push(size_t worker, Task task)
+    {
+        ++pending;
+        {
+            std::lock_guard<std::mutex> lock(queues[worker].mutex);
+            queues[worker].tasks.push_back(std::move(task));
+        }
+        {
+            std::lock_guard<std::mutex> lock(wait_mutex);
+            ++queued;
+        }
+        wake_up.notify_one();
+    }
+
+    bool pop(size_t worker, Task& task)
+    {
+        {
+            auto& own = queues[worker];
+            std::lock_guard<std::mutex> lock(own.mutex);
+            if (!own.tasks.empty()) {
+                task = std::move(own.tasks.back());
+                own.tasks.pop_back();
+                --queued;
+                return true;
+            }
+        }
+        for (size_t i = 1; i < queues.size(); ++i) {
+            auto& victim = queues[(worker + i) % queues.size()];
+            std::lock_guard<std::mutex> lock(victim.mutex);
+            if (!victim.tasks.empty()) {
+                task = std::move(victim.tasks.front());
+                victim.tasks.pop_front();
+                --queued;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // Blocks until a task might be available or there is nothing left to do.
+    // A timed wait is used, since the untimed one needs a libstdc++ built by
+    // gcc 12 or newer, which is missing in some conda environments.
+    void wait()
+    {
+        std::unique_lock<std::mutex> lock(wait_mutex);
+        while (!(queued > 0 || pending == 0 || stopped))
+            wake_up.wait_for(lock, std::chrono::milliseconds(100));
+    }
+
+    void done()
+    {
+        if (--pending == 0) {
+            std::lock_guard<std::mutex> lock(wait_mutex);
+            wake_up.notify_all();
+        }
+    }
+
+    void stop()
+    {
+        {
+            std::lock_guard<std::mutex> lock(wait_mutex);
+            stopped = true;
+        }
+        wake_up.notify_all();
+    }
+
+    bool finished()
+    {
+        std::lock_guard<std::mutex> lock(wait_mutex);
+        return pending == 0 || stopped;
+    }
+};
+
+Cascade::Cascade(std::vector<ParticleDef> p_defs, HandlerFactory factory,
+    double energy_threshold, size_t n_threads)
+    : p_defs(std::move(p_defs))
+    , energy_threshold(energy_threshold)
+    , n_threads(n_threads)
+    , handlers(n_threads)
+{
+    if (n_threads == 0)
+        throw std::invalid_argument("At least one thread is required.");
+    for (auto& worker_handlers : handlers)
+        for (auto const& p : this->p_defs)
+            worker_handlers.emplace(p.particle_type, factory(p));
+}
+
+Cascade::Cascade(std::vector<ParticleDef> p_defs,
+    const nlohmann::json& config, const Medium& medium,
+    double energy_threshold, size_t n_threads)
+    : Cascade(
+        std::move(p_defs),
+        [config, medium](const ParticleDef& p) {
+            auto handler = Handler();
+            handler.propagator = PROPOSAL::make_unique<Propagator>(p, config);
+            auto cuts = std::make_shared<EnergyCutSettings>(INF, 1, false);
+            auto types = CrossSectionVector::GetInteractionTypes(
+                GetStdCrossSections(p, medium, cuts, false));
+            handler.secondaries = PROPOSAL::make_unique<SecondariesCalculator>();
+            for (auto t : types) {
+                try {
+                    handler.secondaries->addInteraction(
+                        DefaultFactory<secondaries::Parametrization>::Create(
+                            t, p, medium));
+                } catch (const std::logic_error&) {
+                    // no secondaries parametrization for this interaction
+                }
+            }
+            return handler;
+        },
+        energy_threshold, n_threads)
+{
+}
+
+Cascade::Products Cascade::Process(
+    const ParticleState& state, Handler& handler, double max_distance)
+{
+    auto track = handler.propagator->Propagate(
+        state, max_distance, energy_threshold);
+
+    auto products = Products();
+    products.final_state = track.GetFinalState();
+    for (auto& loss : track.GetStochasticLosses()) {
+        auto type = static_cast<InteractionType>(loss.type);
+        if (!handler.secondaries || !handler.secondaries->HasInteraction(type))
+            continue;
+        auto rnd = std::vector<double>(
+            handler.secondaries->RequiredRandomNumbers(type));
+        for (auto& r : rnd)
+            r = RandomGenerator::Get().RandomDouble();
+        auto sec = handler.secondaries->CalculateSecondaries(
+            loss, target_component(loss.target_hash), rnd);
+
+        // The propagated particle itself is part of the secondaries if it
+        // survives the interaction. It has already been followed in the
+        // track, so it must not be queued again.
+        if (keeps_primary(type) && !sec.empty())
+            sec.erase(sec.begin());
+
+        for (auto& p : sec) {
+            products.secondaries.push_back(p);
+            products.origins.push_back(type);
+        }
+    }
+    for (auto& p : track.GetDecayProducts()) {
+        products.secondaries.push_back(p);
+        products.origins.push_back(InteractionType::Decay);
+    }
+    return products;
+}
+
+std::vector<CascadeNode> Cascade::Propagate(
+    const ParticleState& primary, double max_distance)
+{
+    // Nodes are appended in the order the tasks are finished, which depends
+    // on the scheduling. The children of a node are stored consecutively and
+    // the tree is sorted at the end.
+    auto nodes = std::vector<CascadeNode>();
+    auto first_child = std::vector<size_t>();
+    auto n_children = std::vector<size_t>();
+    std::mutex nodes_mutex;
+    WorkQueue queue(n_threads);
+
+    auto is_propagated = [this](const ParticleState& p) {
+        return p.energy > energy_threshold
+            && handlers.front().find(p.type) != handlers.front().end();
+    };
+
+    nodes.push_back({ primary, primary, -1, InteractionType::Undefined,
+        is_propagated(primary) });
+    first_child.push_back(0);
+    n_children.push_back(0);
+    if (!nodes.front().propagated)
+        return nodes;
+
+    // The only random number taken from the global generator. Every task
+    // draws its random numbers from its own stream, seeded from the seed of
+    // its parent and its position among the secondaries.
+    auto seed = static_cast<uint64_t>(
+        RandomGenerator::Get().RandomDouble() * 9007199254740992.);
+    queue.push(0, { 0, primary, seed });
+
+    std::exception_ptr error = nullptr;
+    auto worker = [&](size_t w) {
+        TaskRandomStream stream;
+        while (!queue.finished()) {
+            auto task = Task();
+            if (!queue.pop(w, task)) {
+                queue.wait();
+                continue;
+            }
+            try {
+                stream.seed(task.seed);
+                auto products = Process(
+                    task.state, handlers[w].at(task.state.type), max_distance);
+
+                std::lock_guard<std::mutex> lock(nodes_mutex);
+                nodes[task.node].final_state = products.final_state;
+                first_child[task.node] = nodes.size();
+                n_children[task.node] = products.secondaries.size();
+                for (size_t i = 0; i < products.secondaries.size(); ++i) {
+                    auto const& p = products.secondaries[i];
+                    auto propagated = is_propagated(p);
+                    nodes.push_back({ p, p, static_cast<int>(task.node),
+                        products.origins[i], propagated });
+                    first_child.push_back(0);
+                    n_children.push_back(0);
+                    if (propagated)
+                        queue.push(w,
+                            { nodes.size() - 1, p, child_seed(task.seed, i) });
+                }
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(nodes_mutex);
+                if (!error)
+                    error = std::current_exception();
+                queue.stop();
+            }
+            queue.done();
+        }
+    };
+
+    if (n_threads == 1) {
+        worker(0);
+    } else {
+        auto threads = std::vector<std::thread>();
+        for (size_t w = 0; w < n_threads; ++w)
+            threads.emplace_back(worker, w);
+        for (auto& t : threads)
+            t.join();
+    }
+
+    if (error)
+        std::rethrow_exception(error);
+
+    // breadth-first order, children in the order they have been produced
+    auto order = std::vector<size_t> { 0 };
+    auto new_index = std::vector<int>(nodes.size());
+    for (size_t k = 0; k < order.size(); ++k) {
+        new_index[order[k]] = static_cast<int>(k);
+        for (size_t c = 0; c < n_children[order[k]]; ++c)
+            order.push_back(first_child[order[k]] + c);
+    }
+    auto sorted = std::vector<CascadeNode>();
+    sorted.reserve(nodes.size());
+    for (auto n : order) {
+        sorted.push_back(std::move(nodes[n]));
+        if (sorted.back().parent >= 0)
+            sorted.back().parent = new_index[sorted.back().parent];
+    }
+
+    return sorted;
+}
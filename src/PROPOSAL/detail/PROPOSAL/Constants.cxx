@@ -33,6 +33,13 @@ unsigned int InterpolationSettings::NODES_DNDX_V = 100;
 unsigned int InterpolationSettings::NODES_UTILITY = 500;
 unsigned int InterpolationSettings::NODES_RATE_INTERPOLANT = 10000;
 
+// integration settings
+
+IntegrationSettings::Method IntegrationSettings::INNER_INTEGRATION
+    = IntegrationSettings::ADAPTIVE;
+unsigned int IntegrationSettings::GAUSS_LEGENDRE_ORDER = 64;
+double IntegrationSettings::VERIFICATION_TOLERANCE = 1.e-3;
+
 // propagation settings
 
 unsigned int PropagationSettings::ADVANCE_PARTICLE_MAX_STEPS = 200;
@@ -17,7 +17,9 @@
 #include "PROPOSAL/crosssection/ParticleDefaultCrossSectionList.h"
 #include "PROPOSAL/density_distr/density_distr.h"
 #include "PROPOSAL/geometry/GeometryFactory.h"
+#include "PROPOSAL/geometry/LayeredSphere.h"
 #include "PROPOSAL/math/RandomGenerator.h"
+#include "PROPOSAL/math/Vec3.h"
 #include "PROPOSAL/medium/MediumFactory.h"
 #include "PROPOSAL/particle/ParticleDef.h"
 #include "PROPOSAL/propagation_utility/ContRandBuilder.h"
@@ -37,6 +39,7 @@ Propagator::Propagator(const ParticleDef& p_def, std::vector<Sector> sectors)
     : p_def(p_def)
     , sector_list(sectors)
 {
+    InitializeSphereLayers();
 }
 
 Propagator::Propagator(const ParticleDef& p_def, const nlohmann::json& config)
@@ -53,14 +56,91 @@ Propagator::Propagator(const ParticleDef& p_def, const nlohmann::json& config)
     } else {
         throw std::invalid_argument("No sector array found in json object");
     }
+    InitializeSphereLayers();
+}
+
+void Propagator::InitializeSphereLayers()
+{
+    // shells by origin and hierarchy
+    auto shells = std::vector<std::vector<size_t>> {};
+    for (size_t i = 0; i < sector_list.size(); ++i) {
+        auto sphere
+            = dynamic_cast<const Sphere*>(get<GEOMETRY>(sector_list[i]).get());
+        if (!sphere)
+            continue;
+        auto same_group = [this, sphere](const std::vector<size_t>& group) {
+            auto& other = *get<GEOMETRY>(sector_list[group.front()]);
+            return other.GetPosition() == sphere->GetPosition()
+                && other.GetHierarchy() == sphere->GetHierarchy();
+        };
+        auto group = std::find_if(shells.begin(), shells.end(), same_group);
+        if (group == shells.end())
+            shells.push_back({ i });
+        else
+            group->push_back(i);
+    }
+
+    auto inner_radius = [this](size_t i) {
+        return static_cast<const Sphere&>(*get<GEOMETRY>(sector_list[i]))
+            .GetInnerRadius();
+    };
+    auto outer_radius = [this](size_t i) {
+        return static_cast<const Sphere&>(*get<GEOMETRY>(sector_list[i]))
+            .GetRadius();
+    };
+
+    in_sphere_layers.assign(sector_list.size(), false);
+    for (auto& group : shells) {
+        std::stable_sort(group.begin(), group.end(),
+            [&inner_radius](size_t a, size_t b) {
+                return inner_radius(a) < inner_radius(b);
+            });
+
+        // every run of shells without gaps and overlaps becomes one
+        // LayeredSphere
+        auto begin = group.begin();
+        while (begin != group.end()) {
+            auto end = begin + 1;
+            while (end != group.end()
+                && outer_radius(*(end - 1)) == inner_radius(*end)
+                && inner_radius(*end) < outer_radius(*end))
+                ++end;
+            if (end - begin > 1) {
+                auto radii = std::vector<double> { inner_radius(*begin) };
+                for (auto it = begin; it != end; ++it)
+                    radii.push_back(outer_radius(*it));
+                auto& origin = *get<GEOMETRY>(sector_list[*begin]);
+                auto layered_sphere = std::make_shared<LayeredSphere>(
+                    origin.GetPosition(), radii);
+                layered_sphere->SetHierarchy(origin.GetHierarchy());
+                sphere_layers.push_back(
+                    { layered_sphere, std::vector<size_t>(begin, end) });
+                for (auto it = begin; it != end; ++it)
+                    in_sphere_layers[*it] = true;
+            }
+            begin = end;
+        }
+    }
 }
 
 Secondaries Propagator::Propagate(const ParticleState& initial_particle,
     double max_distance, double min_energy, unsigned int hierarchy_condition)
 {
     Secondaries track(std::make_shared<ParticleDef>(p_def), sector_list);
+    auto sink = [&track](const ParticleState& state, InteractionType type,
+                    size_t target_hash) {
+        track.push_back(state, type, target_hash);
+    };
+    Propagate(initial_particle, sink, max_distance, min_energy,
+        hierarchy_condition);
+    return track;
+}
 
-    track.push_back(initial_particle, InteractionType::ContinuousEnergyLoss);
+void Propagator::Propagate(const ParticleState& initial_particle,
+    TrackSink sink, double max_distance, double min_energy,
+    unsigned int hierarchy_condition)
+{
+    sink(initial_particle, InteractionType::ContinuousEnergyLoss, 0);
     auto state = ParticleState(initial_particle);
 
     auto current_sector = GetCurrentSector(state.position, state.direction);
@@ -97,7 +177,7 @@ Secondaries Propagator::Propagate(const ParticleState& initial_particle,
         utility = get<UTILITY>(current_sector);
         density = get<DENSITY_DISTR>(current_sector);
 
-        track.push_back(state, InteractionType::ContinuousEnergyLoss);
+        sink(state, InteractionType::ContinuousEnergyLoss, 0);
 
         switch (advancement_type) {
         case ReachedInteraction:
@@ -105,13 +185,13 @@ Secondaries Propagator::Propagate(const ParticleState& initial_particle,
             case Stochastic: {
                 auto loss = DoStochasticInteraction(state, utility, rnd);
                 if (loss.type != InteractionType::Undefined)
-                    track.push_back(state, loss.type, loss.comp_hash);
+                    sink(state, loss.type, loss.comp_hash);
                 if (state.energy <= InteractionEnergy[MinimalE])
                     continue_propagation = false;
                 break;
             }
             case Decay: {
-                track.push_back(state, InteractionType::Decay);
+                sink(state, InteractionType::Decay, 0);
                 continue_propagation = false;
                 break;
             }
@@ -135,7 +215,6 @@ Secondaries Propagator::Propagate(const ParticleState& initial_particle,
             break;
         }
     }
-    return track;
 }
 
 Interaction::Loss Propagator::DoStochasticInteraction(ParticleState& p_cond,
@@ -162,13 +241,18 @@ int Propagator::AdvanceParticle(ParticleState &state,
     double energy = energy_next_interaction; // final energy of proposed step
     double grammage = -1; // grammage of proposed step
     double distance = -1; // geometrical distance of proposed step
+    double time = -1; // elapsed time of proposed step, if looked up with grammage
 
     // Calculate maximal allowed length of step (limit due to final_distance)
     const double max_distance = final_distance - state.propagated_distance;
 
-    // Calculate grammage until next stochastic interaction
-    double grammage_next_interaction = utility.LengthContinuous(
-            state.energy, energy_next_interaction);
+    // Calculate grammage and time until next stochastic interaction. The
+    // position does not change during the iteration, so the pair is reused
+    // whenever the step reaches the interaction.
+    double grammage_next_interaction, time_next_interaction;
+    std::tie(grammage_next_interaction, time_next_interaction)
+        = utility.LengthAndTimeContinuous(state.energy,
+            energy_next_interaction, density->Evaluate(state.position));
 
     int advancement_type;
     Cartesian3D mean_direction, new_direction; // proposed scattering
@@ -191,8 +275,10 @@ int Propagator::AdvanceParticle(ParticleState &state,
         num_steps++;
         // Calculate grammage, energy and distance for step
         if (energy != -1 && distance == -1) {
-            // Calculate grammage and distance from given energy
-            grammage = utility.LengthContinuous(state.energy, energy);
+            // Calculate distance from given energy, which is always the
+            // energy of the next interaction
+            grammage = grammage_next_interaction;
+            time = time_next_interaction;
             try {
                 distance = density->Correct(state.position, state.direction, grammage, max_distance);
             } catch (const DensityException&) {
@@ -204,6 +290,7 @@ int Propagator::AdvanceParticle(ParticleState &state,
             if (grammage_step < grammage_next_interaction) {
                 grammage = grammage_step;
                 energy = utility.EnergyDistance(state.energy, grammage);
+                time = -1;
             } else {
                 // we are unable to reach `distance` before we reach the next interaction
                 // this means we are stuck in a loop, and need to discard the current set of random numbers
@@ -215,6 +302,7 @@ int Propagator::AdvanceParticle(ParticleState &state,
                                                            "random numbers. Resample set of random numbers.");
                 grammage = grammage_next_interaction;
                 energy = energy_next_interaction;
+                time = time_next_interaction;
                 try {
                     distance = density->Correct(state.position, state.direction, grammage, max_distance);
                 } catch (const DensityException&) {
@@ -232,8 +320,9 @@ int Propagator::AdvanceParticle(ParticleState &state,
                 grammage, state.energy, energy, state.direction, rnd);
 
         // Check step
-        double distance_to_border = CalculateDistanceToBorder(state.position, mean_direction, *geometry);
-        bool is_inside = geometry->IsInside(state.position, mean_direction);
+        auto border = geometry->DistanceToBorder(state.position, mean_direction);
+        double distance_to_border = CalculateDistanceToBorder(state.position, mean_direction, *geometry, border.first);
+        bool is_inside = Geometry::GetLocation(border) == Geometry::ParticleLocation::InsideGeometry;
 
         if (num_steps > PropagationSettings::ADVANCE_PARTICLE_MAX_STEPS) {
             // too many iteration steps!
@@ -248,6 +337,7 @@ int Propagator::AdvanceParticle(ParticleState &state,
             distance = distance_to_border;
             grammage = density->Calculate(state.position, state.direction, distance);
             energy = utility.EnergyDistance(state.energy, grammage);
+            time = -1;
             advancement_type = ReachedBorder;
         } else if (!is_inside) {
             // Special case: We are on the sector border, but scattering back outside the current sector!
@@ -257,10 +347,13 @@ int Propagator::AdvanceParticle(ParticleState &state,
             utility = get<UTILITY>(new_sector);
             density = get<DENSITY_DISTR>(new_sector);
             geometry = get<GEOMETRY>(new_sector);
-            grammage_next_interaction = utility.LengthContinuous(state.energy, energy_next_interaction);
+            std::tie(grammage_next_interaction, time_next_interaction)
+                = utility.LengthAndTimeContinuous(state.energy,
+                    energy_next_interaction, density->Evaluate(state.position));
             energy = energy_next_interaction;
             distance = -1;
             grammage = -1;
+            time = -1;
 
             // if we get in this case, this might mean that we are stuck in a loop.
             // this can happen if we backscatter in both the old and the new sector (if their medium is different).
@@ -287,11 +380,15 @@ int Propagator::AdvanceParticle(ParticleState &state,
             distance = std::min(distance_to_border, max_distance);
             energy = -1;
             grammage = -1;
+            time = -1;
         }
     } while (advancement_type == InvalidStep);
 
-    state.time = state.time + utility.TimeElapsed(state.energy, energy, grammage, density->Evaluate(state.position)); // TODO: should the energy passed here be the randomized energy or not?
-    state.position = state.position + distance * mean_direction;
+    // TODO: should the energy passed to the time be the randomized energy or not?
+    if (time == -1)
+        time = utility.TimeElapsed(state.energy, energy, grammage, density->Evaluate(state.position));
+    state.time = state.time + time;
+    state.position = Vec3(state.position) + distance * Vec3(mean_direction);
     state.direction = new_direction;
     state.propagated_distance = state.propagated_distance + distance;
     if (min_energy_step && advancement_type == ReachedInteraction)
@@ -303,20 +400,30 @@ int Propagator::AdvanceParticle(ParticleState &state,
 }
 
 double Propagator::CalculateDistanceToBorder(const Vector3D& position,
-    const Vector3D& direction, const Geometry& current_geometry)
+    const Vector3D& direction, const Geometry& current_geometry,
+    double distance_border)
 {
-    auto distance_border
-        = current_geometry.DistanceToBorder(position, direction).first;
     double tmp_distance;
-    for (auto& sector : sector_list) {
-        auto& geometry = get<GEOMETRY>(sector);
-        if (geometry->GetHierarchy() > current_geometry.GetHierarchy()) {
+    for (size_t i = 0; i < sector_list.size(); ++i) {
+        auto& geometry = get<GEOMETRY>(sector_list[i]);
+        if (!in_sphere_layers[i]
+            && geometry->GetHierarchy() > current_geometry.GetHierarchy()) {
             tmp_distance
                 = geometry->DistanceToBorder(position, direction).first;
             if (tmp_distance >= 0)
                 distance_border = std::min(distance_border, tmp_distance);
         }
     }
+    // the closest border of all shells of a layered sphere is the next
+    // intersection with any of its radii
+    for (auto& layers : sphere_layers) {
+        if (layers.geometry->GetHierarchy() > current_geometry.GetHierarchy()) {
+            tmp_distance
+                = layers.geometry->DistanceToLayerBorder(position, direction);
+            if (tmp_distance >= 0)
+                distance_border = std::min(distance_border, tmp_distance);
+        }
+    }
     return distance_border;
 }
 
@@ -338,10 +445,25 @@ Sector Propagator::GetCurrentSector(
     const Vector3D& position, const Vector3D& direction)
 {
     auto potential_sec = std::vector<Sector*> {};
-    for (auto& sector : sector_list) {
-        if (get<GEOMETRY>(sector)->IsInside(position, direction))
-            potential_sec.push_back(&sector);
+    for (size_t i = 0; i < sector_list.size(); ++i) {
+        if (!in_sphere_layers[i]
+            && get<GEOMETRY>(sector_list[i])->IsInside(position, direction))
+            potential_sec.push_back(&sector_list[i]);
+    }
+    // Only the shell enclosing the position can contain it. Its neighbours
+    // are tested as well for positions on a border.
+    for (auto& layers : sphere_layers) {
+        auto layer = layers.geometry->GetLayer(position);
+        auto first = layer > 0 ? layer - 1 : 0;
+        auto last = std::min(layer + 2, layers.sectors.size());
+        for (auto i = first; i < last; ++i) {
+            auto& sector = sector_list[layers.sectors[i]];
+            if (get<GEOMETRY>(sector)->IsInside(position, direction))
+                potential_sec.push_back(&sector);
+        }
     }
+    // keep the order of the sector list for sectors of the same hierarchy
+    std::sort(potential_sec.begin(), potential_sec.end());
 
     if (potential_sec.empty()) {
         auto spherical_position = Cartesian3D(position);
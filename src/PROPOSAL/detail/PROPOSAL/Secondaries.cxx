@@ -25,15 +25,37 @@ Secondaries::Secondaries(std::shared_ptr<ParticleDef> p_def,
 
 void Secondaries::reserve(size_t number_secondaries)
 {
-    track_.reserve(number_secondaries);
+    particle_types_.reserve(number_secondaries);
+    positions_.reserve(number_secondaries);
+    directions_.reserve(number_secondaries);
+    energies_.reserve(number_secondaries);
+    times_.reserve(number_secondaries);
+    propagated_distances_.reserve(number_secondaries);
     types_.reserve(number_secondaries);
     target_hashes_.reserve(number_secondaries);
 }
 
+void Secondaries::clear()
+{
+    particle_types_.clear();
+    positions_.clear();
+    directions_.clear();
+    energies_.clear();
+    times_.clear();
+    propagated_distances_.clear();
+    types_.clear();
+    target_hashes_.clear();
+}
+
 void Secondaries::push_back(const ParticleState& point,
                             const InteractionType& type, const size_t& target_hash)
 {
-    track_.push_back(point);
+    particle_types_.push_back(point.type);
+    positions_.push_back(point.position.GetCartesianCoordinates());
+    directions_.push_back(point.direction.GetCartesianCoordinates());
+    energies_.push_back(point.energy);
+    times_.push_back(point.time);
+    propagated_distances_.push_back(point.propagated_distance);
     types_.push_back(type);
     target_hashes_.push_back(target_hash);
 }
@@ -43,39 +65,60 @@ void Secondaries::emplace_back(const ParticleType& particle_type, const Vector3D
     const double& distance, const InteractionType& interaction_type,
     const size_t& target_hash)
 {
-    track_.emplace_back(particle_type, position, direction, energy, time,
-                        distance);
+    particle_types_.push_back(static_cast<int>(particle_type));
+    positions_.push_back(position.GetCartesianCoordinates());
+    directions_.push_back(direction.GetCartesianCoordinates());
+    energies_.push_back(energy);
+    times_.push_back(time);
+    propagated_distances_.push_back(distance);
     types_.emplace_back(interaction_type);
     target_hashes_.push_back(target_hash);
 }
 
+ParticleState Secondaries::operator[](std::size_t idx) const
+{
+    return ParticleState(static_cast<ParticleType>(particle_types_[idx]),
+                         Cartesian3D(positions_[idx]),
+                         Cartesian3D(directions_[idx]), energies_[idx],
+                         times_[idx], propagated_distances_[idx]);
+}
+
 std::vector<ParticleState> Secondaries::GetDecayProducts() const
 {
-    assert(track_.size() == types_.size());
+    assert(energies_.size() == types_.size());
 
     //TODO: Is this necessary, or do we assume that there is only one decay at the end of the vector?
     std::vector<ParticleState> decay_products;
-    for (unsigned int i=0; i<track_.size(); i++) {
+    std::vector<ParticleState> products;
+    for (unsigned int i=0; i<types_.size(); i++) {
         if (types_[i] == InteractionType::Decay) {
-            ParticleState decaying_particle = track_[i];
+            ParticleState decaying_particle = (*this)[i];
             double random_ch = RandomGenerator::Get().RandomDouble();
-            auto products
-                = primary_def_->decay_table.SelectChannel(random_ch).Decay(
-                    *primary_def_, decaying_particle);
-            for (auto p : products) {
-                decay_products.emplace_back(p);
-            }
+            primary_def_->decay_table.SelectChannel(random_ch).Decay(
+                *primary_def_, decaying_particle, products);
+            decay_products.insert(
+                decay_products.end(), products.begin(), products.end());
         }
     }
     return decay_products;
 }
 
+std::vector<ParticleState> Secondaries::GetTrack() const
+{
+    std::vector<ParticleState> vec;
+    vec.reserve(energies_.size());
+    for (unsigned int i=0; i<energies_.size(); i++)
+        vec.push_back((*this)[i]);
+    return vec;
+}
+
 std::vector<ParticleState> Secondaries::GetTrack(const Geometry& geometry) const
 {
     std::vector<ParticleState> vec;
-    for (auto i : track_) {
-        if (geometry.IsInside(i.position, i.direction))
-            vec.push_back(i);
+    for (unsigned int i=0; i<energies_.size(); i++) {
+        if (geometry.IsInside(Cartesian3D(positions_[i]),
+                              Cartesian3D(directions_[i])))
+            vec.push_back((*this)[i]);
     }
     return vec;
 }
@@ -83,82 +126,54 @@ std::vector<ParticleState> Secondaries::GetTrack(const Geometry& geometry) const
 
 ParticleState Secondaries::GetStateForEnergy(double energy) const
 {
-    if (energy >= track_.front().energy)
-        return track_.front();
+    if (energy >= energies_.front())
+        return GetInitialState();
 
-    for (unsigned int i=1; i<track_.size(); i++) {
-        if (track_[i].energy < energy) {
+    for (unsigned int i=1; i<energies_.size(); i++) {
+        if (energies_[i] < energy) {
             if (types_[i] == InteractionType::ContinuousEnergyLoss) {
-                auto displacement = track_[i].position - track_[i-1].position;
+                auto displacement = Cartesian3D(positions_[i])
+                    - Cartesian3D(positions_[i-1]);
                 displacement.normalize();
                 return RePropagateEnergy(
-                        track_[i-1], displacement, track_[i-1].energy - energy,
-                        track_[i-1].propagated_distance - track_[i].propagated_distance);
+                        (*this)[i-1], displacement, energies_[i-1] - energy,
+                        propagated_distances_[i-1] - propagated_distances_[i]);
             } else {
-                return track_[i-1];
+                return (*this)[i-1];
             }
         }
     }
 
-    return track_.back();
+    return back();
 }
 
 ParticleState Secondaries::GetStateForDistance(double propagated_distance) const
 {
-    if (track_.front().propagated_distance >= propagated_distance)
-        return track_.front();
+    if (propagated_distances_.front() >= propagated_distance)
+        return GetInitialState();
 
-    for (unsigned int i=1; i<track_.size(); i++) {
-        if (track_[i].propagated_distance > propagated_distance) {
-            auto displacement = track_[i].position - track_[i-1].position;
+    for (unsigned int i=1; i<propagated_distances_.size(); i++) {
+        if (propagated_distances_[i] > propagated_distance) {
+            auto displacement = Cartesian3D(positions_[i])
+                - Cartesian3D(positions_[i-1]);
             displacement.normalize();
             return RePropagateDistance(
-                    track_[i-1], displacement,
-                    propagated_distance - track_[i-1].propagated_distance);
+                    (*this)[i-1], displacement,
+                    propagated_distance - propagated_distances_[i-1]);
         }
     }
 
-    return track_.back();
+    return back();
 }
 
 std::vector<Cartesian3D> Secondaries::GetTrackPositions() const
 {
-    std::vector<Cartesian3D> vec;
-    for (auto i : track_)
-        vec.emplace_back(i.position);
-    return vec;
+    return std::vector<Cartesian3D>(positions_.begin(), positions_.end());
 }
 
 std::vector<Cartesian3D> Secondaries::GetTrackDirections() const
 {
-    std::vector<Cartesian3D> vec;
-    for (auto i : track_)
-        vec.emplace_back(i.direction);
-    return vec;
-}
-
-std::vector<double> Secondaries::GetTrackEnergies() const
-{
-    std::vector<double> vec;
-    for (auto i : track_)
-        vec.emplace_back(i.energy);
-    return vec;
-}
-
-std::vector<double> Secondaries::GetTrackTimes() const
-{
-    std::vector<double> vec;
-    for (auto i : track_)
-        vec.emplace_back(i.time);
-    return vec;
-}
-
-std::vector<double> Secondaries::GetTrackPropagatedDistances() const
-{
-    std::vector<double> vec;
-    for (auto i : track_)
-        vec.emplace_back(i.propagated_distance);
-    return vec;
+    return std::vector<Cartesian3D>(directions_.begin(), directions_.end());
 }
 
 double Secondaries::GetELost(const Geometry& geometry) const
@@ -171,17 +186,17 @@ double Secondaries::GetELost(const Geometry& geometry) const
 std::shared_ptr<ParticleState> Secondaries::GetEntryPoint(
         const Geometry& geometry) const
 {
-    auto pos_0 = track_.front().position;
-    auto dir_0 = track_.front().direction;
-    if (geometry.IsEntering(pos_0, dir_0))
-        return std::make_unique<ParticleState>(track_.front());
-    if (geometry.IsInside(pos_0, dir_0))
+    auto pos_0 = Cartesian3D(positions_.front());
+    auto dir_0 = Cartesian3D(directions_.front());
+    auto intersections = geometry.GetIntersections(pos_0, dir_0);
+    if (intersections.is_entering)
+        return std::make_unique<ParticleState>(GetInitialState());
+    if (intersections.location == Geometry::ParticleLocation::InsideGeometry)
         return nullptr; // track starts in geometry
 
-    for (unsigned int i = 0; i < track_.size() - 1; i++) {
-        auto pos_i = track_[i].position;
-        auto pos_f = track_[i+1].position;
-        auto dir_i = track_[i].direction;
+    for (unsigned int i = 0; i < positions_.size() - 1; i++) {
+        auto pos_i = Cartesian3D(positions_[i]);
+        auto pos_f = Cartesian3D(positions_[i+1]);
 
         auto displacement = pos_f - pos_i;
         auto dist_i_f = displacement.magnitude();
@@ -190,8 +205,8 @@ std::shared_ptr<ParticleState> Secondaries::GetEntryPoint(
         auto distance = geometry.DistanceToBorder(pos_i, displacement).first;
         if (distance <= dist_i_f && distance >= 0) {
             if (std::abs(dist_i_f - distance) < PARTICLE_POSITION_RESOLUTION)
-                return std::make_unique<ParticleState>(track_[i+1]);
-            auto entry_point = RePropagateDistance(track_[i], displacement,
+                return std::make_unique<ParticleState>((*this)[i+1]);
+            auto entry_point = RePropagateDistance((*this)[i], displacement,
                                                    distance);
             return std::make_unique<ParticleState>(entry_point);
         }
@@ -202,17 +217,17 @@ std::shared_ptr<ParticleState> Secondaries::GetEntryPoint(
 std::shared_ptr<ParticleState> Secondaries::GetExitPoint(
         const Geometry &geometry) const
 {
-    auto pos_end = track_.back().position;
-    auto dir_end = track_.back().direction;
-    if (geometry.IsLeaving(pos_end, dir_end))
-        return std::make_unique<ParticleState>(track_.back());
-    if (geometry.IsInside(pos_end, dir_end))
+    auto pos_end = Cartesian3D(positions_.back());
+    auto dir_end = Cartesian3D(directions_.back());
+    auto intersections = geometry.GetIntersections(pos_end, dir_end);
+    if (intersections.is_leaving)
+        return std::make_unique<ParticleState>(back());
+    if (intersections.location == Geometry::ParticleLocation::InsideGeometry)
         return nullptr; // track ends inside geometry
 
-    for (auto i = track_.size() - 1; i > 0; i--) {
-        auto pos_i = track_[i-1].position;
-        auto pos_f = track_[i].position;
-        auto dir_i = track_[i-1].direction;
+    for (auto i = positions_.size() - 1; i > 0; i--) {
+        auto pos_i = Cartesian3D(positions_[i-1]);
+        auto pos_f = Cartesian3D(positions_[i]);
 
         auto displacement = pos_f - pos_i;
         auto dist_i_f = displacement.magnitude();
@@ -221,17 +236,17 @@ std::shared_ptr<ParticleState> Secondaries::GetExitPoint(
         auto distance = geometry.DistanceToBorder(pos_f, -displacement).first;
         if (distance <= dist_i_f && distance >= 0) {
             if (std::abs(dist_i_f - distance) < PARTICLE_POSITION_RESOLUTION)
-                return std::make_unique<ParticleState>(track_[i-1]);
+                return std::make_unique<ParticleState>((*this)[i-1]);
             auto exit_point = RePropagateDistance(
-                    track_[i-1], displacement, dist_i_f - distance);
+                    (*this)[i-1], displacement, dist_i_f - distance);
             return std::make_unique<ParticleState>(exit_point);
         }
     }
 
-    auto pos_0 = track_.front().position;
-    auto dir_0 = track_.front().direction;
+    auto pos_0 = Cartesian3D(positions_.front());
+    auto dir_0 = Cartesian3D(directions_.front());
     if (geometry.IsLeaving(pos_0, dir_0))
-        return std::make_unique<ParticleState>(track_.front());
+        return std::make_unique<ParticleState>(GetInitialState());
 
     return nullptr; // No exit point found
 }
@@ -239,12 +254,12 @@ std::shared_ptr<ParticleState> Secondaries::GetExitPoint(
 std::shared_ptr<ParticleState> Secondaries::GetClosestApproachPoint(
         const Geometry& geometry) const
 {
-   if (track_.size() == 1)
-       return std::make_unique<ParticleState>(track_.front());
+   if (positions_.size() == 1)
+       return std::make_unique<ParticleState>(GetInitialState());
 
-    for (unsigned int i = 0; i < track_.size() - 1; i++) {
-        auto pos_i = track_[i].position;
-        auto pos_f = track_[i+1].position;
+    for (unsigned int i = 0; i < positions_.size() - 1; i++) {
+        auto pos_i = Cartesian3D(positions_[i]);
+        auto pos_f = Cartesian3D(positions_[i+1]);
 
         auto displacement = pos_f - pos_i;
         auto dist_i_f = displacement.magnitude();
@@ -253,37 +268,40 @@ std::shared_ptr<ParticleState> Secondaries::GetClosestApproachPoint(
         auto distance_to_closest_approach
             = geometry.DistanceToClosestApproach(pos_i, displacement);
         if (std::abs(distance_to_closest_approach - dist_i_f) <= PARTICLE_POSITION_RESOLUTION) {
-            return std::make_unique<ParticleState>(track_[i+1]);
+            return std::make_unique<ParticleState>((*this)[i+1]);
         } else if (distance_to_closest_approach < dist_i_f) {
             if (distance_to_closest_approach < PARTICLE_POSITION_RESOLUTION)
-                return std::make_unique<ParticleState>(track_[i]);
+                return std::make_unique<ParticleState>((*this)[i]);
 
             auto closest_approach = RePropagateDistance(
-                    track_[i], displacement, distance_to_closest_approach);
+                    (*this)[i], displacement, distance_to_closest_approach);
             return std::make_unique<ParticleState>(closest_approach);
         }
     }
-    return std::make_unique<ParticleState>(track_.back());
+    return std::make_unique<ParticleState>(back());
 }
 
 bool Secondaries::HitGeometry(const Geometry& geometry) const {
-    for (unsigned int i = 0; i < track_.size() - 1; i++) {
-        auto pos_a = track_[i].position;
-        auto pos_b = track_[i+1].position;
+    for (unsigned int i = 0; i < positions_.size() - 1; i++) {
+        auto pos_a = Cartesian3D(positions_[i]);
+        auto pos_b = Cartesian3D(positions_[i+1]);
         auto disp = (pos_b - pos_a);
         disp.normalize();
 
         // check if first track point lies inside geometry
-        if (geometry.IsInside(pos_a, disp))
+        auto location = geometry.GetLocation(pos_a, disp);
+        if (location == Geometry::ParticleLocation::InsideGeometry)
             return true;
 
         // check if geometry lies between two track points
-        if (geometry.IsInfront(pos_a, disp) && geometry.IsBehind(pos_b, disp))
+        if (location == Geometry::ParticleLocation::InfrontGeometry
+            && geometry.IsBehind(pos_b, disp))
             return true;
     }
 
     // check if last track point is in geometry
-    if (geometry.IsInside(track_.back().position, track_.back().direction))
+    if (geometry.IsInside(Cartesian3D(positions_.back()),
+                          Cartesian3D(directions_.back())))
         return true;
 
     return false;
@@ -365,20 +383,35 @@ Sector Secondaries::GetCurrentSector(const Vector3D& position,
     return **highest_sector_iter;
 }
 
+StochasticLoss Secondaries::stochastic_loss(size_t i) const
+{
+    return StochasticLoss(static_cast<int>(types_[i]),
+                          energies_[i-1] - energies_[i],
+                          Cartesian3D(positions_[i]),
+                          Cartesian3D(directions_[i]), times_[i],
+                          propagated_distances_[i], energies_[i-1],
+                          target_hashes_[i]);
+}
+
+ContinuousLoss Secondaries::continuous_loss(size_t i) const
+{
+    return ContinuousLoss(energies_[i-1] - energies_[i], energies_[i-1],
+                          Cartesian3D(positions_[i-1]),
+                          Cartesian3D(positions_[i]),
+                          Cartesian3D(directions_[i-1]),
+                          Cartesian3D(directions_[i]), times_[i-1], times_[i]);
+}
+
 std::vector<StochasticLoss> Secondaries::GetStochasticLosses() const
 {
-    assert(track_.size() == types_.size());
+    assert(energies_.size() == types_.size());
 
     std::vector<StochasticLoss> losses;
-    for (unsigned int i=1; i<track_.size(); i++) {
+    for (unsigned int i=1; i<types_.size(); i++) {
         auto interaction_type = types_[i];
         if (interaction_type != InteractionType::ContinuousEnergyLoss &&
                 interaction_type != InteractionType::Decay) {
-            losses.emplace_back(static_cast<int>(interaction_type),
-                                track_[i-1].energy - track_[i].energy,
-                                track_[i].position, track_[i].direction,
-                                track_[i].time, track_[i].propagated_distance,
-                                track_[i-1].energy, target_hashes_[i]);
+            losses.push_back(stochastic_loss(i));
         }
     }
     return losses;
@@ -386,20 +419,16 @@ std::vector<StochasticLoss> Secondaries::GetStochasticLosses() const
 
 std::vector<StochasticLoss> Secondaries::GetStochasticLosses(const Geometry& geometry) const
 {
-    assert(track_.size() == types_.size());
+    assert(energies_.size() == types_.size());
 
     std::vector<StochasticLoss> losses;
-    for (unsigned int i=1; i<track_.size(); i++) {
-        if (geometry.IsInside(track_[i].position, track_[i].direction)) {
-            auto interaction_type = types_[i];
-            if (interaction_type != InteractionType::ContinuousEnergyLoss &&
-               interaction_type != InteractionType::Decay) {
-                losses.emplace_back(static_cast<int>(interaction_type),
-                                    track_[i-1].energy - track_[i].energy,
-                                    track_[i].position, track_[i].direction,
-                                    track_[i].time, track_[i].propagated_distance,
-                                    track_[i-1].energy, target_hashes_[i]);
-            }
+    for (unsigned int i=1; i<types_.size(); i++) {
+        auto interaction_type = types_[i];
+        if (interaction_type != InteractionType::ContinuousEnergyLoss &&
+           interaction_type != InteractionType::Decay) {
+            if (geometry.IsInside(Cartesian3D(positions_[i]),
+                                  Cartesian3D(directions_[i])))
+                losses.push_back(stochastic_loss(i));
         }
     }
     return losses;
@@ -407,18 +436,12 @@ std::vector<StochasticLoss> Secondaries::GetStochasticLosses(const Geometry& geo
 
 std::vector<StochasticLoss> Secondaries::GetStochasticLosses(const InteractionType& type) const
 {
-    assert(track_.size() == types_.size());
+    assert(energies_.size() == types_.size());
 
     std::vector<StochasticLoss> losses;
-    for (unsigned int i=1; i<track_.size(); i++) {
-        auto interaction_type = types_[i];
-        if (interaction_type == type) {
-            losses.emplace_back(static_cast<int>(interaction_type),
-                                track_[i-1].energy - track_[i].energy,
-                                track_[i].position, track_[i].direction,
-                                track_[i].time, track_[i].propagated_distance,
-                                track_[i-1].energy, target_hashes_[i]);
-        }
+    for (unsigned int i=1; i<types_.size(); i++) {
+        if (types_[i] == type)
+            losses.push_back(stochastic_loss(i));
     }
     return losses;
 }
@@ -438,38 +461,28 @@ std::vector<StochasticLoss> Secondaries::GetStochasticLosses(
 
 std::vector<ContinuousLoss> Secondaries::GetContinuousLosses() const
 {
-    assert(track_.size() == types_.size());
+    assert(energies_.size() == types_.size());
 
     std::vector<ContinuousLoss> losses;
-    for (unsigned int i=1; i<track_.size(); i++) {
-        if (types_[i] == InteractionType::ContinuousEnergyLoss) {
-            losses.emplace_back( track_[i-1].energy - track_[i].energy,
-                                 track_[i-1].energy,
-                                 track_[i-1].position, track_[i].position,
-                                 track_[i-1].direction, track_[i].direction,
-                                 track_[i-1].time, track_[i].time);
-        }
+    for (unsigned int i=1; i<types_.size(); i++) {
+        if (types_[i] == InteractionType::ContinuousEnergyLoss)
+            losses.push_back(continuous_loss(i));
     }
     return losses;
 }
 
 std::vector<ContinuousLoss> Secondaries::GetContinuousLosses(const Geometry& geometry) const
 {
-    assert(track_.size() == types_.size());
+    assert(energies_.size() == types_.size());
 
     //TODO: At the moment, part of the continuous losses may be missing if
     // the track points are not exactly on the geometry border
     std::vector<ContinuousLoss> losses;
-    for (unsigned int i=1; i<track_.size(); i++) {
-        if (geometry.IsInside(track_[i].position, track_[i].direction)) {
-            if (types_[i] == InteractionType::ContinuousEnergyLoss) {
-                losses.emplace_back(
-                        track_[i-1].energy - track_[i].energy,
-                        track_[i-1].energy,
-                        track_[i-1].position, track_[i].position,
-                        track_[i-1].direction, track_[i].direction,
-                        track_[i-1].time, track_[i].time);
-            }
+    for (unsigned int i=1; i<types_.size(); i++) {
+        if (types_[i] == InteractionType::ContinuousEnergyLoss) {
+            if (geometry.IsInside(Cartesian3D(positions_[i]),
+                                  Cartesian3D(directions_[i])))
+                losses.push_back(continuous_loss(i));
         }
     }
     return losses;
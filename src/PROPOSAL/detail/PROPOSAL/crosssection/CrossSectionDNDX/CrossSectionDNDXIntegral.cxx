@@ -25,7 +25,7 @@ namespace detail {
             auto dNdx = [param_ptr = ptr.get(), &p, &t, E](double v) {
                 return param_ptr->DifferentialCrossSection(p, t, E, v);
             };
-            return i.Integrate(v_min, v_max, dNdx, 4);
+            return i.Integrate(v_min, v_max, std::cref(dNdx), 4);
         };
     }
 
@@ -55,7 +55,7 @@ namespace detail {
                 return std::exp(t)
                        * ptr->DifferentialCrossSection(p, c, E, 1. - std::exp(t));
             };
-            return i.Integrate(t_max, t_min, dNdx, 2);
+            return i.Integrate(t_max, t_min, std::cref(dNdx), 2);
         };
     }
 
@@ -68,7 +68,7 @@ namespace detail {
             auto dNdx = [param_ptr = ptr.get(), &p, &m, E](double v) {
                 return param_ptr->DifferentialCrossSection(p, m, E, v);
             };
-            return i.Integrate(v_min, v_max, dNdx, 3, 1);
+            return i.Integrate(v_min, v_max, std::cref(dNdx), 3, 1);
         };
     }
 
@@ -82,7 +82,7 @@ namespace detail {
             auto dNdx = [param_ptr = ptr.get(), &p, &c, E](double v) {
                 return param_ptr->DifferentialCrossSection(p, c, E, v);
             };
-            return i.Integrate(v_min, v_max, dNdx, 3);
+            return i.Integrate(v_min, v_max, std::cref(dNdx), 3);
         };
     }
 
@@ -96,7 +96,7 @@ namespace detail {
             auto dNdx = [param_ptr = ptr.get(), &p, &t, E](double v) {
                 return param_ptr->DifferentialCrossSection(p, t, E, v);
             };
-            i.IntegrateWithRandomRatio(v_min, v_max, dNdx, 4, rnd);
+            i.IntegrateWithRandomRatio(v_min, v_max, std::cref(dNdx), 4, rnd);
             return i.GetUpperLimit();
         };
     }
@@ -130,7 +130,7 @@ namespace detail {
                 return std::exp(t)
                     * ptr->DifferentialCrossSection(p, c, E, 1. - std::exp(t));
             };
-            i.IntegrateWithRandomRatio(t_min, t_max, dNdx, 3, rate);
+            i.IntegrateWithRandomRatio(t_min, t_max, std::cref(dNdx), 3, rate);
             return 1. - std::exp(i.GetUpperLimit());
         };
     }
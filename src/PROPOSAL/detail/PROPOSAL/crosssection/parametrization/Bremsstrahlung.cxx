@@ -432,8 +432,8 @@ double crosssection::BremsSandrockSoedingreksoRhode::CalculateParametrization(
 // ------------------------------------------------------------------------- //
 
 crosssection::BremsElectronScreening::BremsElectronScreening(bool lpm)
-    : interpolant_(new Interpolant(
-        A_logZ, A_energies, A_correction, 2, false, false, 2, false, false))
+    : interpolant_(new Interpolant(A_logZ.ToVector(), A_energies.ToVector(),
+        A_correction.ToVector(), 2, false, false, 2, false, false))
 {
     if (lpm)
         throw std::invalid_argument("Missing particle_def and medium for "
@@ -444,8 +444,8 @@ crosssection::BremsElectronScreening::BremsElectronScreening(bool lpm)
 
 crosssection::BremsElectronScreening::BremsElectronScreening(bool lpm,
     const ParticleDef& p_def, const Medium& medium, double density_correction)
-    : interpolant_(new Interpolant(
-        A_logZ, A_energies, A_correction, 2, false, false, 2, false, false))
+    : interpolant_(new Interpolant(A_logZ.ToVector(), A_energies.ToVector(),
+        A_correction.ToVector(), 2, false, false, 2, false, false))
 {
     if (lpm) {
         lpm_ = std::make_shared<BremsLPM>(p_def, medium, *this);
@@ -129,12 +129,16 @@ namespace detail {
 crosssection::EpairProductionRhoIntegral::EpairProductionRhoIntegral(bool lpm)
     : crosssection::EpairProduction(lpm)
 {
+    if (inner_integration.IsFixedOrder())
+        hash_combine(hash, inner_integration.GetOrder());
 }
 
 crosssection::EpairProductionRhoIntegral::EpairProductionRhoIntegral(bool lpm,
     const ParticleDef& p_def, const Medium& medium, double density_correction)
     : crosssection::EpairProduction(lpm, p_def, medium, density_correction)
 {
+    if (inner_integration.IsFixedOrder())
+        hash_combine(hash, inner_integration.GetOrder());
 }
 
 // ------------------------------------------------------------------------- //
@@ -161,8 +165,10 @@ double crosssection::EpairProductionRhoIntegral::DifferentialCrossSection(
     };
 
     return NA / comp.GetAtomicNum()
-        * (integral.Integrate(1 - rMax, aux, func, 2)
-            + integral.Integrate(aux, 1, func, 4));
+        * (inner_integration.Integrate(
+               integral, 1 - rMax, aux, std::cref(func), 2)
+            + inner_integration.Integrate(
+                integral, aux, 1, std::cref(func), 4));
 }
 
 /******************************************************************************
@@ -56,6 +56,8 @@ crosssection::MupairProduction::GetKinematicLimits(
 crosssection::MupairProductionRhoIntegral::MupairProductionRhoIntegral()
     : MupairProduction()
 {
+    if (inner_integration.IsFixedOrder())
+        hash_combine(hash, inner_integration.GetOrder());
 }
 
 double crosssection::MupairProductionRhoIntegral::DifferentialCrossSection(
@@ -70,12 +72,11 @@ double crosssection::MupairProductionRhoIntegral::DifferentialCrossSection(
     auto rMax = aux;
 
     Integral integral(IROMB, IMAXS, IPREC);
+    auto func = [this, &p_def, &comp, energy, v](double r) {
+        return FunctionToIntegral(p_def, comp, energy, v, r);
+    };
     return NA / comp.GetAtomicNum()
-        * (integral.Integrate(0, rMax,
-            std::bind(
-                &crosssection::MupairProductionRhoIntegral::FunctionToIntegral,
-                this, p_def, comp, energy, v, std::placeholders::_1),
-            2));
+        * inner_integration.Integrate(integral, 0, rMax, std::cref(func), 2);
 }
 
 MUPAIR_PARAM_INTEGRAL_IMPL(KelnerKokoulinPetrukhin)
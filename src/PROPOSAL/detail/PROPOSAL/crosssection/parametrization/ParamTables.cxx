@@ -1,9 +1,24 @@
 
 #include "PROPOSAL/crosssection/parametrization/ParamTables.h"
 
+using namespace PROPOSAL;
+
+namespace {
+template <size_t N> constexpr ParamArray make_view(const double (&data)[N])
+{
+    return { data, N };
+}
+
+template <size_t R, size_t C>
+constexpr ParamTable make_view(const double (&data)[R][C])
+{
+    return { &data[0][0], R, C };
+}
+} // namespace
+
 // Weak interaction
 
-const std::vector<double> PROPOSAL::energies = {
+constexpr double energies_data[] = {
         4.0, 4.1, 4.2, 4.3, 4.4, 4.5, 4.6, 4.7, 4.8, 4.9,
         5.0, 5.1, 5.2, 5.3, 5.4, 5.5, 5.6, 5.7, 5.8, 5.9,
         6.0, 6.1, 6.2, 6.3, 6.4, 6.5, 6.6, 6.7, 6.8, 6.9,
@@ -18,7 +33,7 @@ const std::vector<double> PROPOSAL::energies = {
         15.0
 };
 
-const std::vector< std::vector<double> > PROPOSAL::y_nu_p = {
+constexpr double y_nu_p_data[][100] = {
 {0.05244  , 0.0540251, 0.0556581, 0.0573405, 0.0590737, 0.0608592,
  0.0626988, 0.064594 , 0.0665464, 0.0685579, 0.0706301, 0.072765 ,
  0.0749645, 0.0772304, 0.0795648, 0.0819697, 0.0844474, 0.0869999,
@@ -2297,7 +2312,7 @@ const std::vector< std::vector<double> > PROPOSAL::y_nu_p = {
  3.22898e-01, 4.28350e-01, 5.68241e-01, 7.53818e-01, 1.00000e+00}
 };
 
-const std::vector< std::vector<double> > PROPOSAL::sigma_nu_p = {
+constexpr double sigma_nu_p_data[][100] = {
 {1.49873e-07, 1.53254e-06, 5.78771e-06, 1.52603e-05, 3.29075e-05,
  6.21520e-05, 1.06610e-04, 1.70088e-04, 2.56420e-04, 3.69192e-04,
  5.12205e-04, 6.88492e-04, 9.00235e-04, 1.14947e-03, 1.43817e-03,
@@ -4594,7 +4609,7 @@ const std::vector< std::vector<double> > PROPOSAL::sigma_nu_p = {
  4.91399e+04, 3.56461e+04, 2.51216e+04, 1.72082e+04, 1.16529e+04}
 };
 
-const std::vector< std::vector<double> > PROPOSAL::y_nubar_p = {
+constexpr double y_nubar_p_data[][100] = {
 {0.05244  , 0.0540251, 0.0556581, 0.0573405, 0.0590737, 0.0608592,
  0.0626988, 0.064594 , 0.0665464, 0.0685579, 0.0706301, 0.072765 ,
  0.0749645, 0.0772304, 0.0795648, 0.0819697, 0.0844474, 0.0869999,
@@ -6873,7 +6888,7 @@ const std::vector< std::vector<double> > PROPOSAL::y_nubar_p = {
  3.22898e-01, 4.28350e-01, 5.68241e-01, 7.53818e-01, 1.00000e+00}
 };
 
-const std::vector< std::vector<double> > PROPOSAL::sigma_nubar_p = {
+constexpr double sigma_nubar_p_data[][100] = {
 {5.61824e-07, 4.85030e-06, 1.81049e-05, 5.54042e-05, 1.36737e-04,
  2.83401e-04, 5.16502e-04, 8.54930e-04, 1.31452e-03, 1.90606e-03,
  2.63730e-03, 3.51002e-03, 4.52070e-03, 5.66286e-03, 6.92811e-03,
@@ -9134,7 +9149,7 @@ const std::vector< std::vector<double> > PROPOSAL::sigma_nubar_p = {
  4.91399e+04, 3.56461e+04, 2.51216e+04, 1.72082e+04, 1.16529e+04}
 };
 
-const std::vector< std::vector<double> > PROPOSAL::y_nu_n = {
+constexpr double y_nu_n_data[][100] = {
 {0.0523654, 0.053949 , 0.0555805, 0.0572613, 0.0589929, 0.060777 ,
  0.0626149, 0.0645085, 0.0664593, 0.0684691, 0.0705397, 0.0726729,
  0.0748707, 0.0771348, 0.0794675, 0.0818707, 0.0843466, 0.0868973,
@@ -11413,7 +11428,7 @@ const std::vector< std::vector<double> > PROPOSAL::y_nu_n = {
  3.22880e-01, 4.28333e-01, 5.68226e-01, 7.53807e-01, 1.00000e+00}
 };
 
-const std::vector< std::vector<double> > PROPOSAL::sigma_nu_n = {
+constexpr double sigma_nu_n_data[][100] = {
 {5.79350e-07, 5.00519e-06, 1.87559e-05, 5.79158e-05, 1.44069e-04,
  3.00542e-04, 5.50844e-04, 9.16468e-04, 1.41599e-03, 2.06284e-03,
  2.86738e-03, 3.83370e-03, 4.96021e-03, 6.24208e-03, 7.67241e-03,
@@ -13674,7 +13689,7 @@ const std::vector< std::vector<double> > PROPOSAL::sigma_nu_n = {
  4.91548e+04, 3.56556e+04, 2.51274e+04, 1.72114e+04, 1.16546e+04}
 };
 
-const std::vector< std::vector<double> > PROPOSAL::y_nubar_n = {
+constexpr double y_nubar_n_data[][100] = {
 {0.0523654, 0.053949 , 0.0555805, 0.0572613, 0.0589929, 0.060777 ,
  0.0626149, 0.0645085, 0.0664593, 0.0684691, 0.0705397, 0.0726729,
  0.0748707, 0.0771348, 0.0794675, 0.0818707, 0.0843466, 0.0868973,
@@ -15953,7 +15968,7 @@ const std::vector< std::vector<double> > PROPOSAL::y_nubar_n = {
  3.22880e-01, 4.28333e-01, 5.68226e-01, 7.53807e-01, 1.00000e+00}
 };
 
-const std::vector< std::vector<double> > PROPOSAL::sigma_nubar_n = {
+constexpr double sigma_nubar_n_data[][100] = {
 {1.42776e-07, 1.45688e-06, 5.49190e-06, 1.44537e-05, 3.11033e-05,
  5.86066e-05, 1.00268e-04, 1.59519e-04, 2.39765e-04, 3.44118e-04,
  4.75834e-04, 6.37383e-04, 8.30405e-04, 1.05635e-03, 1.31656e-03,
@@ -18249,7 +18264,7 @@ const std::vector< std::vector<double> > PROPOSAL::sigma_nubar_n = {
 
 // BremsElectronScreening
 
-const std::vector<double> PROPOSAL::A_energies = {
+constexpr double A_energies_data[] = {
  1.0000e-03, 1.2500e-03, 1.5000e-03, 1.7500e-03, 2.0000e-03, 2.5000e-03, 3.0000e-03,
  3.5000e-03, 4.0000e-03, 4.5000e-03, 5.0000e-03, 5.5000e-03, 6.0000e-03, 7.0000e-03,
  8.0000e-03, 9.0000e-03, 1.0000e-02, 1.2500e-02, 1.5000e-02, 1.7500e-02, 2.0000e-02,
@@ -18269,11 +18284,11 @@ const std::vector<double> PROPOSAL::A_energies = {
  9.0000e+03, 1.0000e+04, 1.25e+4
 };
 
-const std::vector<double> PROPOSAL::A_logZ = {0., 0.69314718, 1.79175947, 2.07944154,
+constexpr double A_logZ_data[] = {0., 0.69314718, 1.79175947, 2.07944154,
   2.56494936, 2.99573227, 3.36729583, 3.68887945, 3.91202301, 4.17438727, 4.30406509,
   4.36944785, 4.52178858, 4.60517019};
 
-const std::vector< std::vector<double> > PROPOSAL::A_correction = {
+constexpr double A_correction_data[][115] = {
 {4.5687e+01, 3.6763e+01, 3.0817e+01, 2.6574e+01, 2.3388e+01, 1.8935e+01, 1.5963e+01,
 1.3837e+01, 1.2241e+01, 1.0995e+01, 9.9973e+00, 9.1803e+00, 8.4983e+00, 7.4237e+00,
 6.6134e+00, 5.9821e+00, 5.4741e+00, 4.5521e+00, 3.9306e+00, 3.4809e+00, 3.1397e+00,
@@ -18516,14 +18531,14 @@ const std::vector< std::vector<double> > PROPOSAL::A_correction = {
 
 // PhotoPairKochMotz
 
-const std::vector<double> PROPOSAL::photopair_KM_energies = {
+constexpr double photopair_KM_energies_data[] = {
 1.0219978922, 1.50000734,  2.00000564,  2.99999313,  3.99998256,
 5.00001044,  6.00000318,  7.99998767, 10.00004907, 14.99999698,
 19.99995453, 30.00007855, 40.00002184, 49.99984973, 59.99972627,
 80.00026923, 99.9999814
 };
 
-const std::vector<double> PROPOSAL::photopair_KM_Z = {
+constexpr double photopair_KM_Z_data[] = {
 1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,
 14,  15,  16,  17,  18,  19,  20,  21,  22,  23,  24,  25,  26,
 27,  28,  29,  30,  31,  32,  33,  34,  35,  36,  37,  38,  39,
@@ -18534,7 +18549,7 @@ const std::vector<double> PROPOSAL::photopair_KM_Z = {
 92,  93,  94,  95,  96,  97,  98,  99, 100
 };
 
-const std::vector< std::vector<double> > PROPOSAL::photopair_KM_cross = {
+constexpr double photopair_KM_cross_data[][17] = {
 {2.80260456e-45, 4.42998175e-05, 1.77000146e-04, 5.50997658e-04,
 9.94003331e-04, 1.43000119e-03, 1.84999933e-03, 2.63999040e-03,
 3.30999037e-03, 4.60998812e-03, 5.61002558e-03, 7.08000971e-03,
@@ -19035,4 +19050,22 @@ const std::vector< std::vector<double> > PROPOSAL::photopair_KM_cross = {
 1.73000605e+01, 2.18000007e+01, 2.55000395e+01, 3.09001179e+01,
 3.42001490e+01, 3.70000772e+01, 3.89999358e+01, 4.20000160e+01,
 4.41000096e+01}
-};
\ No newline at end of file
+};
+
+// Views on the tables, they are constant initialized.
+
+constexpr ParamArray PROPOSAL::energies = make_view(energies_data);
+constexpr ParamTable PROPOSAL::y_nu_p = make_view(y_nu_p_data);
+constexpr ParamTable PROPOSAL::y_nubar_p = make_view(y_nubar_p_data);
+constexpr ParamTable PROPOSAL::y_nu_n = make_view(y_nu_n_data);
+constexpr ParamTable PROPOSAL::y_nubar_n = make_view(y_nubar_n_data);
+constexpr ParamTable PROPOSAL::sigma_nu_p = make_view(sigma_nu_p_data);
+constexpr ParamTable PROPOSAL::sigma_nubar_p = make_view(sigma_nubar_p_data);
+constexpr ParamTable PROPOSAL::sigma_nu_n = make_view(sigma_nu_n_data);
+constexpr ParamTable PROPOSAL::sigma_nubar_n = make_view(sigma_nubar_n_data);
+constexpr ParamArray PROPOSAL::A_energies = make_view(A_energies_data);
+constexpr ParamArray PROPOSAL::A_logZ = make_view(A_logZ_data);
+constexpr ParamTable PROPOSAL::A_correction = make_view(A_correction_data);
+constexpr ParamArray PROPOSAL::photopair_KM_energies = make_view(photopair_KM_energies_data);
+constexpr ParamArray PROPOSAL::photopair_KM_Z = make_view(photopair_KM_Z_data);
+constexpr ParamTable PROPOSAL::photopair_KM_cross = make_view(photopair_KM_cross_data);
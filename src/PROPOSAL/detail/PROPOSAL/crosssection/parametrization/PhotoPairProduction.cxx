@@ -82,8 +82,9 @@ crosssection::PhotoPairKochMotz::clone() const
 }
 
 crosssection::PhotoPairKochMotz::PhotoPairKochMotz(bool lpm)
-        : interpolant_(new Interpolant(photopair_KM_Z, photopair_KM_energies,
-                                     photopair_KM_cross, 2, false, false,
+        : interpolant_(new Interpolant(photopair_KM_Z.ToVector(),
+                                     photopair_KM_energies.ToVector(),
+                                     photopair_KM_cross.ToVector(), 2, false, false,
                                      2, false, false))
 {
     if (lpm)
@@ -97,8 +98,9 @@ crosssection::PhotoPairKochMotz::PhotoPairKochMotz(bool lpm)
 crosssection::PhotoPairKochMotz::PhotoPairKochMotz(
         bool lpm, const ParticleDef& p_def, const Medium& medium,
         double density_correction)
-    : interpolant_(new Interpolant(photopair_KM_Z, photopair_KM_energies,
-                                   photopair_KM_cross, 2, false, false,
+    : interpolant_(new Interpolant(photopair_KM_Z.ToVector(),
+                                   photopair_KM_energies.ToVector(),
+                                   photopair_KM_cross.ToVector(), 2, false, false,
                                    2, false, false))
 {
     if (lpm) {
@@ -124,7 +126,7 @@ double crosssection::PhotoPairKochMotz::DifferentialCrossSection(
     auto integrand = [this, &p, &comp, energy](double v) {
         return this->DifferentialCrossSectionWithoutA(p, comp, energy, v) / NA * comp.GetAtomicNum() / (1e-24);
     };
-    auto dNdx_nocorrection = i.Integrate(limits.v_min, limits.v_max, integrand, 3);
+    auto dNdx_nocorrection = i.Integrate(limits.v_min, limits.v_max, std::cref(integrand), 3);
     auto A = interpolant_->InterpolateArray(comp.GetNucCharge(), energy) / dNdx_nocorrection;
     return A * DifferentialCrossSectionWithoutA(p, comp, energy, v);
 }
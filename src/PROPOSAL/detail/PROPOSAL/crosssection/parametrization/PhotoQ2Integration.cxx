@@ -31,6 +31,8 @@ crosssection::PhotoQ2Integral::PhotoQ2Integral(
     : shadow_effect_(shadow_effect)
 {
     hash_combine(hash, shadow_effect_->GetHash());
+    if (inner_integration.IsFixedOrder())
+        hash_combine(hash, inner_integration.GetOrder());
 }
 
 double crosssection::PhotoQ2Integral::DifferentialCrossSection(
@@ -57,10 +59,11 @@ double crosssection::PhotoQ2Integral::DifferentialCrossSection(
         return 0;
 
     Integral integral;
-    aux = integral.Integrate(q2_min, q2_max,
-        std::bind(&crosssection::PhotoQ2Integral::FunctionToQ2Integral, this,
-            p_def, comp, energy, v, std::placeholders::_1),
-        4);
+    auto func = [this, &p_def, &comp, energy, v](double Q2) {
+        return FunctionToQ2Integral(p_def, comp, energy, v, Q2);
+    };
+    aux = inner_integration.Integrate(
+        integral, q2_min, q2_max, std::cref(func), 4);
 
     aux *= NA / comp.GetAtomicNum() * p_def.charge * p_def.charge;
 
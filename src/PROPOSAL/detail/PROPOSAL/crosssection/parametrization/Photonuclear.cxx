@@ -5,7 +5,6 @@
 #include "PROPOSAL/Logging.h"
 #include "PROPOSAL/crosssection/parametrization/Parametrization.h"
 #include "PROPOSAL/crosssection/parametrization/Photonuclear.h"
-#include "PROPOSAL/math/Interpolant.h"
 #include "PROPOSAL/medium/Components.h"
 #include "PROPOSAL/medium/Medium.h"
 #include "PROPOSAL/methods.h"
@@ -28,7 +27,7 @@ crosssection::HardComponent::HardComponent(const ParticleDef& particle_def)
 
     if (!y.empty()) {
         for (unsigned int i = 0; i < y.size(); i++) {
-            interpolant_.emplace_back(x, y.at(i), 4, false, false);
+            interpolant_.emplace_back(x, y.at(i));
         }
     } else {
         Logging::Get("proposal.parametrization")
@@ -59,7 +58,7 @@ double crosssection::HardComponent::CalculateHardComponent(
             aux *= lov;
         }
 
-        sum += aux * interpolant_[i].InterpolateArray(loe);
+        sum += aux * interpolant_[i](loe);
     }
     return sum / v;
 }
@@ -8,7 +8,6 @@
 #include "PROPOSAL/medium/Components.h"
 #include "PROPOSAL/particle/ParticleDef.h"
 
-#include "PROPOSAL/math/Interpolant.h"
 #include "PROPOSAL/methods.h"
 
 using namespace PROPOSAL;
@@ -40,17 +39,23 @@ crosssection::WeakCooperSarkarMertsch::clone() const
 crosssection::WeakCooperSarkarMertsch::WeakCooperSarkarMertsch()
 {
     hash_combine(hash, std::string("cooper_sarkar_mertsch"));
-    auto interpolant_particle_p = std::make_shared<Interpolant>(energies,
-        y_nubar_p, sigma_nubar_p, IROMB, false, false, IROMB, false, false);
-    auto interpolant_particle_n = std::make_shared<Interpolant>(energies,
-        y_nubar_n, sigma_nubar_n, IROMB, false, false, IROMB, false, false);
+    // The tables are identical for all instances and only built once. The
+    // grids in v are equidistant in log(v) between the kinematic limits.
+    auto make_table = [](const ParamTable& v, const ParamTable& sigma) {
+        auto log_v = v.ToVector();
+        for (auto& row : log_v)
+            for (auto& x : row)
+                x = std::log(x);
+        return std::make_shared<TabulatedCubic2D>(
+            energies.ToVector(), log_v, sigma.ToVector());
+    };
+    static auto interpolant_particle_p = make_table(y_nubar_p, sigma_nubar_p);
+    static auto interpolant_particle_n = make_table(y_nubar_n, sigma_nubar_n);
     interpolants_particle
         = std::make_pair(interpolant_particle_p, interpolant_particle_n);
 
-    auto interpolant_antiparticle_p = std::make_shared<Interpolant>(
-        energies, y_nu_p, sigma_nu_p, IROMB, false, false, IROMB, false, false);
-    auto interpolant_antiparticle_n = std::make_shared<Interpolant>(
-        energies, y_nu_n, sigma_nu_n, IROMB, false, false, IROMB, false, false);
+    static auto interpolant_antiparticle_p = make_table(y_nu_p, sigma_nu_p);
+    static auto interpolant_antiparticle_n = make_table(y_nu_n, sigma_nu_n);
     interpolants_antiparticle = std::make_pair(
         interpolant_antiparticle_p, interpolant_antiparticle_n);
 }
@@ -60,6 +65,7 @@ double crosssection::WeakCooperSarkarMertsch::DifferentialCrossSection(
     double v) const
 {
     auto log10_energy = std::log10(energy);
+    auto log_v = std::log(v);
     const auto& nuclear_charge = comp.GetNucCharge();
     const auto& nuclear_number = comp.GetAtomicNum();
 
@@ -67,14 +73,12 @@ double crosssection::WeakCooperSarkarMertsch::DifferentialCrossSection(
     double neutron_contr = (nuclear_number - nuclear_charge);
     if (p_def.charge < 0.) {
         proton_contr
-            *= interpolants_particle.first->InterpolateArray(log10_energy, v);
+            *= (*interpolants_particle.first)(log10_energy, log_v);
         neutron_contr
-            *= interpolants_particle.second->InterpolateArray(log10_energy, v);
+            *= (*interpolants_particle.second)(log10_energy, log_v);
     } else {
-        proton_contr *= interpolants_antiparticle.first->InterpolateArray(
-            log10_energy, v);
-        neutron_contr *= interpolants_antiparticle.second->InterpolateArray(
-            log10_energy, v);
+        proton_contr *= (*interpolants_antiparticle.first)(log10_energy, log_v);
+        neutron_contr *= (*interpolants_antiparticle.second)(log10_energy, log_v);
     }
 
     auto mean_contr = (proton_contr + neutron_contr) / nuclear_number;
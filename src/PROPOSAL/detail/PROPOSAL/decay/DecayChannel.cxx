@@ -50,13 +50,28 @@ std::ostream& operator<<(std::ostream& os, DecayChannel const& channel)
 
 } // namespace PROPOSAL
 
+// ------------------------------------------------------------------------- //
+std::vector<ParticleState> DecayChannel::Decay(const ParticleDef& p_def, const ParticleState& p_condition)
+{
+    std::vector<ParticleState> products;
+    Decay(p_def, p_condition, products);
+    return products;
+}
+
 // ------------------------------------------------------------------------- //
 void DecayChannel::Boost(ParticleState& particle, const Vector3D& direction_unnormalized, double gamma, double betagamma)
+{
+    Boost(particle, particle.GetParticleDef().mass, direction_unnormalized, gamma, betagamma);
+}
+
+// ------------------------------------------------------------------------- //
+void DecayChannel::Boost(ParticleState& particle, double mass, const Vector3D& direction_unnormalized, double gamma, double betagamma)
 {
     Cartesian3D direction = direction_unnormalized;
     direction.normalize();
 
-    Cartesian3D momentum_vec(particle.GetMomentum() * particle.direction);
+    double momentum = std::sqrt((particle.energy + mass) * (particle.energy - mass));
+    Cartesian3D momentum_vec(momentum * particle.direction);
 
     double direction_correction =
         (gamma - 1.0) * (momentum_vec * direction) - betagamma * particle.energy;
@@ -64,7 +79,8 @@ void DecayChannel::Boost(ParticleState& particle, const Vector3D& direction_unno
     momentum_vec = momentum_vec + direction_correction * direction;
 
     // Energy will be implicit corrected with respect to the mass:
-    particle.SetMomentum(momentum_vec.magnitude());
+    momentum = momentum_vec.magnitude();
+    particle.energy = std::sqrt(momentum * momentum + mass * mass);
 
     momentum_vec.normalize();
     particle.direction = momentum_vec;
@@ -79,6 +95,15 @@ void DecayChannel::Boost(std::vector<ParticleState>& secondaries, const Vector3D
     }
 }
 
+// ------------------------------------------------------------------------- //
+void DecayChannel::Boost(std::vector<ParticleState>& secondaries, const std::vector<double>& masses, const Vector3D& direction, double gamma, double betagamma)
+{
+    for (size_t i = 0; i < secondaries.size(); ++i)
+    {
+        Boost(secondaries[i], masses[i], direction, gamma, betagamma);
+    }
+}
+
 // ------------------------------------------------------------------------- //
 double DecayChannel::Momentum(double m1, double m2, double m3)
 {
@@ -108,8 +133,16 @@ double DecayChannel::Momentum(double m1, double m2, double m3)
 // ------------------------------------------------------------------------- //
 Cartesian3D DecayChannel::GenerateRandomDirection()
 {
-    double phi       = 2.0 * PI * RandomGenerator::Get().RandomDouble();
-    double cos_theta = 2.0 * RandomGenerator::Get().RandomDouble() - 1.0;
+    double rnd_phi   = RandomGenerator::Get().RandomDouble();
+    double rnd_theta = RandomGenerator::Get().RandomDouble();
+    return GenerateRandomDirection(rnd_phi, rnd_theta);
+}
+
+// ------------------------------------------------------------------------- //
+Cartesian3D DecayChannel::GenerateRandomDirection(double rnd_phi, double rnd_theta)
+{
+    double phi       = 2.0 * PI * rnd_phi;
+    double cos_theta = 2.0 * rnd_theta - 1.0;
     double sin_theta = std::sqrt((1.0 - cos_theta) * (1.0 + cos_theta));
     Cartesian3D direction(sin_theta * std::cos(phi), sin_theta * std::sin(phi), cos_theta);
     return direction;
@@ -1,5 +1,7 @@
 
+#include <algorithm>
 #include <sstream>
+#include <stdexcept>
 
 #include "PROPOSAL/decay/DecayTable.h"
 #include "PROPOSAL/decay/DecayChannel.h"
@@ -18,17 +20,28 @@ using namespace PROPOSAL;
 // ------------------------------------------------------------------------- //
 DecayTable::DecayTable()
     : channels_()
+    , alias_channels_()
+    , alias_probability_()
+    , alias_index_()
 {
 }
 
 // ------------------------------------------------------------------------- //
 DecayTable::DecayTable(const DecayTable& table)
+    : channels_()
+    , alias_channels_()
+    , alias_probability_(table.alias_probability_)
+    , alias_index_(table.alias_index_)
 {
-    clearTable();
+    // the alias table refers to the channels in the order of the map, so
+    // only the pointers to the cloned channels have to be replaced
+    alias_channels_.reserve(table.alias_channels_.size());
 
     for (DecayMap::const_iterator iter = table.channels_.begin(); iter != table.channels_.end(); ++iter)
     {
-        channels_[iter->first] = iter->second->clone();
+        DecayChannel* channel = iter->second->clone();
+        channels_[iter->first] = channel;
+        alias_channels_.push_back(channel);
     }
 }
 
@@ -52,6 +65,9 @@ void PROPOSAL::swap(DecayTable& first, DecayTable& second)
 {
     using std::swap;
     swap(first.channels_, second.channels_);
+    swap(first.alias_channels_, second.alias_channels_);
+    swap(first.alias_probability_, second.alias_probability_);
+    swap(first.alias_index_, second.alias_index_);
 }
 
 bool DecayTable::operator==(const DecayTable& table) const
@@ -107,26 +123,22 @@ std::ostream& operator<<(std::ostream& os, DecayTable const& table)
 // ------------------------------------------------------------------------- //
 DecayChannel& DecayTable::SelectChannel(double rnd) const
 {
-    double sumBranchingRatio = 0.0;
-    for (DecayMap::const_iterator iter = channels_.begin(); iter != channels_.end(); ++iter)
+    if (alias_channels_.empty())
     {
-        sumBranchingRatio += iter->first;
+        Logging::Get("proposal.decay")->error("No decay channel found. If your particle is stable, call \"SetStable\"!");
+        throw std::out_of_range("DecayTable is empty.");
     }
-    rnd = sumBranchingRatio * rnd;
-    double partial_br_sum = 0.0;
 
-    for (DecayMap::const_iterator iter = channels_.begin(); iter != channels_.end(); ++iter)
-    {
-        partial_br_sum += iter->first;
+    // the integer part of rnd * n selects the bin, the fractional part
+    // decides between the channel of the bin and its alias
+    double bin = rnd * alias_channels_.size();
+    size_t index = std::min(static_cast<size_t>(bin), alias_channels_.size() - 1);
 
-        if (rnd < partial_br_sum)
-        {
-            return *iter->second;
-        }
+    if (bin - index < alias_probability_[index])
+    {
+        return *alias_channels_[index];
     }
-
-    Logging::Get("proposal.decay")->error("No decay channel found. If your particle is stable, call \"SetStable\"!");
-    return *channels_.begin()->second; // return first channel just to prevent warnings
+    return *alias_channels_[alias_index_[index]];
 }
 
 // ------------------------------------------------------------------------- //
@@ -137,12 +149,19 @@ void DecayTable::SetStable()
     // TODO(mario): Find better way Wed 2017/08/23
     // A stable channel which alwas will be selected
     channels_[1.1] = new StableChannel();
+    buildAliasTable();
 }
 
 // ------------------------------------------------------------------------- //
 DecayTable& DecayTable::addChannel(double Br, const DecayChannel& dc)
 {
+    auto it = channels_.find(Br);
+    if (it != channels_.end())
+    {
+        delete it->second;
+    }
     channels_[Br] = dc.clone();
+    buildAliasTable();
     return *this;
 }
 
@@ -170,4 +189,55 @@ void DecayTable::clearTable()
     }
 
     channels_.clear();
+    buildAliasTable();
+}
+
+// ------------------------------------------------------------------------- //
+void DecayTable::buildAliasTable()
+{
+    size_t n = channels_.size();
+
+    alias_channels_.clear();
+    alias_probability_.assign(n, 1.0);
+    alias_index_.resize(n);
+
+    double sumBranchingRatio = 0.0;
+    for (DecayMap::const_iterator iter = channels_.begin(); iter != channels_.end(); ++iter)
+    {
+        sumBranchingRatio += iter->first;
+        alias_channels_.push_back(iter->second);
+    }
+
+    // branching ratios scaled to a mean of one, sorted into bins which are
+    // under- and overfull
+    std::vector<double> scaled;
+    std::vector<size_t> small, large;
+    for (DecayMap::const_iterator iter = channels_.begin(); iter != channels_.end(); ++iter)
+    {
+        size_t i = scaled.size();
+        scaled.push_back(iter->first * n / sumBranchingRatio);
+        alias_index_[i] = i;
+        if (scaled[i] < 1.0)
+            small.push_back(i);
+        else
+            large.push_back(i);
+    }
+
+    // fill every underfull bin with the rest of an overfull one
+    while (!small.empty() && !large.empty())
+    {
+        size_t s = small.back();
+        size_t l = large.back();
+        small.pop_back();
+
+        alias_probability_[s] = scaled[s];
+        alias_index_[s] = l;
+        scaled[l] -= 1.0 - scaled[s];
+        if (scaled[l] < 1.0)
+        {
+            large.pop_back();
+            small.push_back(l);
+        }
+    }
+    // the remaining bins are full up to rounding errors
 }
@@ -1,6 +1,10 @@
 #include <functional>
+#include <algorithm>
+#include <atomic>
 #include <cmath>
 #include <cassert>
+#include <mutex>
+#include <unordered_map>
 
 #include "PROPOSAL/Constants.h"
 #include "PROPOSAL/decay/LeptonicDecayChannel.h"
@@ -8,6 +12,7 @@
 #include "PROPOSAL/particle/Particle.h"
 #include "PROPOSAL/particle/ParticleDef.h"
 #include "PROPOSAL/math/MathMethods.h"
+#include "PROPOSAL/methods.h"
 
 template<typename T, typename... Args>
 std::unique_ptr<T> make_unique(Args&&... args)
@@ -32,6 +37,7 @@ LeptonicDecayChannelApprox::LeptonicDecayChannelApprox(const ParticleDef& lepton
     , massive_lepton_(lepton)
     , neutrino_(neutrino)
     , anti_neutrino_(anti_neutrino)
+    , energy_table_()
 {
 }
 
@@ -44,6 +50,7 @@ LeptonicDecayChannelApprox::LeptonicDecayChannelApprox(const LeptonicDecayChanne
     , massive_lepton_(mode.massive_lepton_)
     , neutrino_(mode.neutrino_)
     , anti_neutrino_(mode.anti_neutrino_)
+    , energy_table_(std::atomic_load(&mode.energy_table_))
 {
 }
 
@@ -90,26 +97,87 @@ double LeptonicDecayChannelApprox::FindRoot(double min, double parent_mass, doub
 
     return NewtonRaphson(std::bind(&LeptonicDecayChannelApprox::DecayRate, this, std::placeholders::_1, parent_mass, E_max, right_side),
                          std::bind(&LeptonicDecayChannelApprox::DifferentialDecayRate, this, std::placeholders::_1, parent_mass, E_max),
-                         min, max, x_start, 40, 1e-3);
+                         min, max, x_start, 100, 1e-9);
+}
+
+// ------------------------------------------------------------------------- //
+std::shared_ptr<const LeptonicDecayChannelApprox::EnergyTable>
+LeptonicDecayChannelApprox::BuildEnergyTable(double parent_mass)
+{
+    // maximal interpolation error of x is below 1e-4
+    const unsigned int nodes = 200;
+
+    double emax  = (parent_mass * parent_mass + massive_lepton_.mass * massive_lepton_.mass) / (2 * parent_mass);
+    double x_min = massive_lepton_.mass / emax;
 
+    double f_min = DecayRate(x_min, parent_mass, emax, 0.0);
+    double f_max = DecayRate(1.0, parent_mass, emax, 0.0);
 
+    auto table = std::make_shared<EnergyTable>();
+    table->parent_mass = parent_mass;
+    table->x.resize(nodes);
+    table->x.front() = x_min;
+    table->x.back()  = 1.0;
+
+    for (unsigned int i = 1; i < nodes - 1; ++i)
+    {
+        double rnd        = std::pow(static_cast<double>(i) / (nodes - 1), 3);
+        double right_side = f_min + (f_max - f_min) * rnd;
+        table->x[i]       = FindRoot(x_min, parent_mass, emax, right_side);
+    }
+
+    return table;
 }
 
 // ------------------------------------------------------------------------- //
-std::vector<ParticleState> LeptonicDecayChannelApprox::Decay(const ParticleDef& p_def, const ParticleState& p_condition)
+std::shared_ptr<const LeptonicDecayChannelApprox::EnergyTable>
+LeptonicDecayChannelApprox::GetEnergyTable(double parent_mass)
+{
+    // Channels are cloned with every copy of their ParticleDef, e.g. once per
+    // propagated particle, so the tables are cached for the whole process.
+    static std::mutex mutex;
+    static std::unordered_map<size_t, std::shared_ptr<const EnergyTable>> tables;
+
+    auto hash = std::hash<std::string>{}(GetName());
+    hash_combine(hash, parent_mass, massive_lepton_.mass, neutrino_.mass, anti_neutrino_.mass);
+
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = tables.find(hash);
+    if (it != tables.end())
+        return it->second;
+    auto table = BuildEnergyTable(parent_mass);
+    tables.emplace(hash, table);
+    return table;
+}
+
+// ------------------------------------------------------------------------- //
+double LeptonicDecayChannelApprox::SampleEnergyFraction(double parent_mass, double rnd)
+{
+    // channels may be shared between threads, the table is replaced as a whole
+    auto table = std::atomic_load(&energy_table_);
+    if (!table || table->parent_mass != parent_mass)
+    {
+        table = GetEnergyTable(parent_mass);
+        std::atomic_store(&energy_table_, table);
+    }
+
+    const auto& x = table->x;
+    double u      = std::cbrt(rnd) * (x.size() - 1);
+    size_t i      = std::min(static_cast<size_t>(u), x.size() - 2);
+
+    return x[i] + (u - i) * (x[i + 1] - x[i]);
+}
+
+// ------------------------------------------------------------------------- //
+void LeptonicDecayChannelApprox::Decay(const ParticleDef& p_def, const ParticleState& p_condition, std::vector<ParticleState>& secondaries)
 {
     assert (p_condition.direction.magnitude() > 0);
     // Sample energy from decay rate
     double emax       = (p_def.mass * p_def.mass + massive_lepton_.mass * massive_lepton_.mass) / (2 * p_def.mass);
-    double x_min      = massive_lepton_.mass / emax;
 
-    double f_min      = DecayRate(x_min, p_def.mass, emax, 0.0);
-    double f_max      = DecayRate(1.0, p_def.mass, emax, 0.0);
-    double right_side = f_min + (f_max - f_min) * RandomGenerator::Get().RandomDouble();
+    double x = SampleEnergyFraction(p_def.mass, RandomGenerator::Get().RandomDouble());
 
-    double find_root = FindRoot(x_min, p_def.mass, emax, right_side);
-
-    double lepton_energy   = std::max(find_root * emax, massive_lepton_.mass);
+    double lepton_energy   = std::max(x * emax, massive_lepton_.mass);
     double lepton_momentum = std::sqrt((lepton_energy - massive_lepton_.mass) * (lepton_energy + massive_lepton_.mass));
 
 
@@ -155,7 +223,7 @@ std::vector<ParticleState> LeptonicDecayChannelApprox::Decay(const ParticleDef&
     Boost(anti_neutrino, massive_lepton.direction, gamma, betagamma);
 
 
-    std::vector<ParticleState> secondaries;
+    secondaries.clear();
     secondaries.push_back(massive_lepton);
     secondaries.push_back(neutrino);
     secondaries.push_back(anti_neutrino);
@@ -165,8 +233,6 @@ std::vector<ParticleState> LeptonicDecayChannelApprox::Decay(const ParticleDef&
     double primary_momentum = std::sqrt(std::max((p_condition.energy + p_def.mass) * (p_condition.energy - p_def.mass), 0.0));
     // Boost all products in Lab frame (the reason, why the boosting goes in the negative direction of the particle)
     Boost(secondaries, -p_condition.direction, p_condition.energy/p_def.mass, primary_momentum/p_def.mass);
-
-    return secondaries;
 }
 
 
@@ -26,6 +26,11 @@ ManyBodyPhaseSpace::ManyBodyPhaseSpace(std::vector<std::shared_ptr<const Particl
     , matrix_element_()
     , use_default_matrix_element_(true)
     , estimate_(nullptr)
+    , parameter_cache_(std::make_shared<ParameterCache>())
+    , kinematics_()
+    , randoms_()
+    , sorted_randoms_()
+    , event_products_()
 {
     if (me == nullptr)
     {
@@ -58,6 +63,11 @@ ManyBodyPhaseSpace::ManyBodyPhaseSpace(const ManyBodyPhaseSpace& mode)
     , broad_phase_statistic_(mode.broad_phase_statistic_)
     , matrix_element_(mode.matrix_element_)
     , use_default_matrix_element_(mode.use_default_matrix_element_)
+    , parameter_cache_(mode.parameter_cache_)
+    , kinematics_()
+    , randoms_()
+    , sorted_randoms_()
+    , event_products_()
 {
     if (use_default_matrix_element_)
     {
@@ -103,70 +113,140 @@ bool ManyBodyPhaseSpace::compare(const DecayChannel& channel) const
 }
 
 // ------------------------------------------------------------------------- //
-std::vector<ParticleState> ManyBodyPhaseSpace::Decay(const ParticleDef& p_def, const ParticleState& p_condition)
+void ManyBodyPhaseSpace::Decay(const ParticleDef& p_def, const ParticleState& p_condition, std::vector<ParticleState>& products)
 {
-    // Create vector for decay products
-    std::vector<ParticleState> products;
-
-    for (auto p : daughters_) {
-        products.emplace_back((ParticleType)p->particle_type, p_condition.position, p_condition.direction, p_condition.energy, p_condition.time, 0);
-    }
+    InitProducts(products, p_condition);
 
     // prefactor for the phase space density
-    PhaseSpaceParameters params = GetPhaseSpaceParams(p_def);
-    PhaseSpaceKinematics kinematics;
+    const PhaseSpaceParameters& params = GetPhaseSpaceParams(p_def);
 
-    if (uniform_)
-    {
-        double weight_ref;
-        double weight_sample;
-        do
-        {
-            // precalculated kinematics
-            kinematics = CalculateKinematics(params.normalization, p_def.mass);
-            GenerateEvent(products, kinematics);
-            // sample product states with rejection sampling
-            weight_ref = params.weight_min + RandomGenerator::Get().RandomDouble() * (params.weight_max - params.weight_min);
-            weight_sample = kinematics.weight * matrix_element_(p_condition, products);
-
-        } while(weight_ref > weight_sample);
-    }
-    else
+    do
     {
-        // precalculated kinematics
-        kinematics = CalculateKinematics(params.normalization, p_def.mass);
-        GenerateEvent(products, kinematics);
-    }
+        DrawRandoms(1, RandomsPerEvent());
+    } while (!SampleEvent(p_def, p_condition, params, products, randoms_.data()));
 
     // Get Momentum is not defined for pseudo particle decay, so it must be
     // calculated manually
     double primary_momentum = std::sqrt(std::max((p_condition.energy + p_def.mass) * (p_condition.energy - p_def.mass), 0.0));
     // Boost all products in Lab frame (the reason, why the boosting goes in the negative direction of the particle)
-    Boost(products, -p_condition.direction, p_condition.energy/p_def.mass, primary_momentum / p_def.mass);
+    Boost(products, daughter_masses_, -p_condition.direction, p_condition.energy/p_def.mass, primary_momentum / p_def.mass);
+}
+
+// ------------------------------------------------------------------------- //
+void ManyBodyPhaseSpace::Decay(const ParticleDef& p_def, const std::vector<ParticleState>& p_conditions, std::vector<ParticleState>& products)
+{
+    products.clear();
+    products.reserve(p_conditions.size() * daughters_.size());
+
+    const PhaseSpaceParameters& params = GetPhaseSpaceParams(p_def);
+    size_t randoms_per_event = RandomsPerEvent();
+
+    // Every event needs at least one trial, so a block drawn for the
+    // remaining events is used up before the last of them is accepted.
+    size_t trial = 0;
+    size_t trials = 0;
+
+    for (size_t i = 0; i < p_conditions.size(); ++i)
+    {
+        const ParticleState& p_condition = p_conditions[i];
+        InitProducts(event_products_, p_condition);
 
-    return products;
+        bool accepted = false;
+        while (!accepted)
+        {
+            if (trial == trials)
+            {
+                trials = p_conditions.size() - i;
+                trial = 0;
+                DrawRandoms(trials, randoms_per_event);
+            }
+            accepted = SampleEvent(p_def, p_condition, params, event_products_, &randoms_[trial * randoms_per_event]);
+            ++trial;
+        }
+
+        double primary_momentum = std::sqrt(std::max((p_condition.energy + p_def.mass) * (p_condition.energy - p_def.mass), 0.0));
+        Boost(event_products_, daughter_masses_, -p_condition.direction, p_condition.energy/p_def.mass, primary_momentum / p_def.mass);
+
+        products.insert(products.end(), event_products_.begin(), event_products_.end());
+    }
 }
 
 // ------------------------------------------------------------------------- //
-void ManyBodyPhaseSpace::GenerateEvent(std::vector<ParticleState>& products, const PhaseSpaceKinematics& kinematics)
+bool ManyBodyPhaseSpace::SampleEvent(const ParticleDef& p_def, const ParticleState& p_condition, const PhaseSpaceParameters& params, std::vector<ParticleState>& products, const double* rnd)
+{
+    // precalculated kinematics
+    CalculateKinematics(kinematics_, params.normalization, p_def.mass, rnd);
+    GenerateEvent(products, kinematics_, rnd + number_of_daughters_ - 2);
+
+    if (!uniform_)
+    {
+        return true;
+    }
+
+    // sample product states with rejection sampling
+    double rnd_ref = rnd[number_of_daughters_ - 2 + 2 * (number_of_daughters_ - 1)];
+    double weight_ref = params.weight_min + rnd_ref * (params.weight_max - params.weight_min);
+    double weight_sample = kinematics_.weight;
+    if (!use_default_matrix_element_)
+    {
+        weight_sample *= matrix_element_(p_condition, products);
+    }
+
+    return weight_ref <= weight_sample;
+}
+
+// ------------------------------------------------------------------------- //
+void ManyBodyPhaseSpace::InitProducts(std::vector<ParticleState>& products, const ParticleState& p_condition) const
+{
+    products.clear();
+
+    for (const auto& p : daughters_) {
+        products.emplace_back((ParticleType)p->particle_type, p_condition.position, p_condition.direction, p_condition.energy, p_condition.time, 0);
+    }
+}
+
+// ------------------------------------------------------------------------- //
+size_t ManyBodyPhaseSpace::RandomsPerEvent() const
+{
+    size_t n = daughters_.size();
+    return (n - 2) + 2 * (n - 1) + (uniform_ ? 1 : 0);
+}
+
+// ------------------------------------------------------------------------- //
+void ManyBodyPhaseSpace::DrawRandoms(size_t events, size_t randoms_per_event)
+{
+    randoms_.resize(events * randoms_per_event);
+
+    for (auto& rnd : randoms_)
+    {
+        rnd = RandomGenerator::Get().RandomDouble();
+    }
+}
+
+// ------------------------------------------------------------------------- //
+void ManyBodyPhaseSpace::GenerateEvent(std::vector<ParticleState>& products, const PhaseSpaceKinematics& kinematics, const double* rnd)
 {
     // Calculate first momentum in R2
-    Cartesian3D direction = GenerateRandomDirection();
+    Cartesian3D direction = GenerateRandomDirection(rnd[0], rnd[1]);
+
+    // the energies are set from the known masses, since looking up the
+    // particle definition of the type is expensive
+    double momentum = kinematics.momenta[0];
 
     products[1].direction = direction;
-    products[1].SetMomentum(kinematics.momenta[0]);
+    products[1].energy = std::sqrt(momentum * momentum + daughter_masses_[1] * daughter_masses_[1]);
 
     Cartesian3D opposite_direction = -direction;
     products[0].direction = opposite_direction;
-    products[0].SetMomentum(kinematics.momenta[0]);
+    products[0].energy = std::sqrt(momentum * momentum + daughter_masses_[0] * daughter_masses_[0]);
 
     // Correct the previous momenta
     for (unsigned int i = 2; i < daughter_masses_.size(); ++i)
     {
-        double momentum = kinematics.momenta[i-1];
+        momentum = kinematics.momenta[i-1];
 
-        products[i].direction = GenerateRandomDirection();
-        products[i].SetMomentum(momentum);
+        products[i].direction = GenerateRandomDirection(rnd[2 * (i - 1)], rnd[2 * (i - 1) + 1]);
+        products[i].energy = std::sqrt(momentum * momentum + daughter_masses_[i] * daughter_masses_[i]);
 
         // Boost previous particles to new frame
 
@@ -178,7 +258,7 @@ void ManyBodyPhaseSpace::GenerateEvent(std::vector<ParticleState>& products, con
         for (unsigned int s = 0; s < i; ++s)
         {
             // Boost in -p_i direction
-            Boost(products[s], products[i].direction, gamma, betagamma);
+            Boost(products[s], daughter_masses_[s], products[i].direction, gamma, betagamma);
         }
     }
 }
@@ -199,11 +279,15 @@ double ManyBodyPhaseSpace::Evaluate(const ParticleState& p_condition, const std:
 }
 
 // ------------------------------------------------------------------------- //
-ManyBodyPhaseSpace::PhaseSpaceParameters ManyBodyPhaseSpace::GetPhaseSpaceParams(const ParticleDef& parent_def)
+const ManyBodyPhaseSpace::PhaseSpaceParameters& ManyBodyPhaseSpace::GetPhaseSpaceParams(const ParticleDef& parent_def)
 {
-    ParameterMap::iterator it = parameter_map_.find(parent_def);
+    // copies of the channel may decay in different threads. Elements of the
+    // map are never erased, so the reference stays valid after unlocking.
+    std::lock_guard<std::mutex> lock(parameter_cache_->mutex);
+    auto& parameters = parameter_cache_->parameters;
+    ParameterMap::iterator it = parameters.find(parent_def.mass);
 
-    if (it != parameter_map_.end())
+    if (it != parameters.end())
     {
         return it->second;
     } else
@@ -213,9 +297,7 @@ ManyBodyPhaseSpace::PhaseSpaceParameters ManyBodyPhaseSpace::GetPhaseSpaceParams
         params.normalization = CalculateNormalization(parent_def.mass);
         estimate_(params, parent_def);
 
-        parameter_map_[parent_def] = params;
-
-        return params;
+        return parameters[parent_def.mass] = params;
     }
 }
 
@@ -254,7 +336,7 @@ void ManyBodyPhaseSpace::SampleEstimateMaxWeight(PhaseSpaceParameters& params, c
     // Create vector for decay products
     std::vector<ParticleState> products;
 
-    for (auto d : daughters_) {
+    for (const auto& d : daughters_) {
         products.emplace_back();
         products.back().type = d->particle_type;
     }
@@ -264,18 +346,22 @@ void ManyBodyPhaseSpace::SampleEstimateMaxWeight(PhaseSpaceParameters& params, c
     particle.type = parent_def.particle_type;
     particle.energy = parent_def.mass;
 
-    // initialization of weights
-    PhaseSpaceKinematics kinematics = CalculateKinematics(params.normalization, parent_def.mass);
-    GenerateEvent(products, kinematics);
-    double result = kinematics.weight * matrix_element_(particle, products);
-    params.weight_min = result;
-    params.weight_max = result;
+    // the random numbers of an event without the one for the rejection
+    size_t randoms_per_event = (daughters_.size() - 2) + 2 * (daughters_.size() - 1);
 
-    for (int i = 1; i < broad_phase_statistic_; ++i)
+    for (int i = 0; i < broad_phase_statistic_; ++i)
     {
-        kinematics = CalculateKinematics(params.normalization, parent_def.mass);
-        GenerateEvent(products, kinematics);
-        result = kinematics.weight * matrix_element_(particle, products);
+        DrawRandoms(1, randoms_per_event);
+        CalculateKinematics(kinematics_, params.normalization, parent_def.mass, randoms_.data());
+        GenerateEvent(products, kinematics_, randoms_.data() + number_of_daughters_ - 2);
+        double result = kinematics_.weight * matrix_element_(particle, products);
+
+        // initialization of weights
+        if (i == 0)
+        {
+            params.weight_min = result;
+            params.weight_max = result;
+        }
 
         if (result < params.weight_min)
         {
@@ -290,47 +376,40 @@ void ManyBodyPhaseSpace::SampleEstimateMaxWeight(PhaseSpaceParameters& params, c
 }
 
 // ------------------------------------------------------------------------- //
-ManyBodyPhaseSpace::PhaseSpaceKinematics ManyBodyPhaseSpace::CalculateKinematics(double normalization, double parent_mass)
+void ManyBodyPhaseSpace::CalculateKinematics(PhaseSpaceKinematics& kinematics, double normalization, double parent_mass, const double* rnd)
 {
-    PhaseSpaceKinematics kinematics;
-
     // Create sorted random numbers
-    std::vector<double> randoms;
-    randoms.reserve(daughters_.size());
+    sorted_randoms_.resize(daughters_.size());
+    sorted_randoms_.front() = 0.0;
+    std::copy(rnd, rnd + daughters_.size() - 2, sorted_randoms_.begin() + 1);
+    sorted_randoms_.back() = 1.0;
 
-    randoms.push_back(0.0);
-
-    for (unsigned int i = 0; i < daughter_masses_.size() - 2; ++i)
-    {
-        randoms.push_back(RandomGenerator::Get().RandomDouble());
-    }
-
-    randoms.push_back(1.0);
-
-    std::sort(randoms.begin(), randoms.end());
+    std::sort(sorted_randoms_.begin() + 1, sorted_randoms_.end() - 1);
 
     // Calculate virtual masses
+    kinematics.virtual_masses.resize(number_of_daughters_);
+
     double intermediate_mass = 0.0;
     for (int i = 0; i < number_of_daughters_; ++i)
     {
         intermediate_mass += daughter_masses_[i];
-        kinematics.virtual_masses.push_back(intermediate_mass + randoms[i] * (parent_mass - sum_daughter_masses_));
+        kinematics.virtual_masses[i] = intermediate_mass + sorted_randoms_[i] * (parent_mass - sum_daughter_masses_);
     }
 
     // Calculate intermediate momenta
+    kinematics.momenta.resize(number_of_daughters_ - 1);
+
     double weight = 1.0;
     double momentum = 0.0;
 
     for (int i = 1; i < number_of_daughters_; ++i)
     {
         momentum = Momentum(kinematics.virtual_masses[i], kinematics.virtual_masses[i - 1], daughter_masses_[i]);
-        kinematics.momenta.push_back(momentum);
+        kinematics.momenta[i - 1] = momentum;
         weight *= momentum;
     }
 
     kinematics.weight = normalization * weight;
-
-    return kinematics;
 }
 
 // ------------------------------------------------------------------------- //
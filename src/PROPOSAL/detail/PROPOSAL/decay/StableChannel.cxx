@@ -29,9 +29,8 @@ bool StableChannel::compare(const DecayChannel& channel) const
         return true;
 }
 
-std::vector<ParticleState> StableChannel::Decay(const ParticleDef&, const ParticleState&)
+void StableChannel::Decay(const ParticleDef&, const ParticleState&, std::vector<ParticleState>& products)
 {
-    // return empty vector;
-    std::vector<ParticleState> vec;
-    return vec;
+    // no decay products
+    products.clear();
 }
@@ -38,9 +38,9 @@ bool TwoBodyPhaseSpace::compare(const DecayChannel& channel) const
         return true;
 }
 
-std::vector<ParticleState> TwoBodyPhaseSpace::Decay(const ParticleDef& p_def, const ParticleState& p_condition)
+void TwoBodyPhaseSpace::Decay(const ParticleDef& p_def, const ParticleState& p_condition, std::vector<ParticleState>& products)
 {
-    std::vector<ParticleState> products;
+    products.clear();
     products.emplace_back((ParticleType)first_daughter_.particle_type, p_condition.position, p_condition.direction, p_condition.energy, p_condition.time, 0);
     products.emplace_back((ParticleType)second_daughter_.particle_type, p_condition.position, p_condition.direction, p_condition.energy, p_condition.time, 0);
 
@@ -59,8 +59,6 @@ std::vector<ParticleState> TwoBodyPhaseSpace::Decay(const ParticleDef& p_def, co
     double primary_momentum = std::sqrt(std::max((p_condition.energy + p_def.mass) * (p_condition.energy - p_def.mass), 0.0));
     // Boost all products in Lab frame (the reason, why the boosting goes in the negative direction of the particle)
     Boost(products, -p_condition.direction, p_condition.energy / p_def.mass, primary_momentum / p_def.mass);
-
-    return products;
 }
 
 // ------------------------------------------------------------------------- //
@@ -8,6 +8,7 @@
 #include "PROPOSAL/density_distr/density_splines.h"
 #include "PROPOSAL/medium/Medium.h"
 #include "PROPOSAL/math/Cartesian3D.h"
+#include "PROPOSAL/math/Vec3.h"
 #include <nlohmann/json.hpp>
 
 using namespace PROPOSAL;
@@ -95,14 +96,14 @@ RadialAxis::RadialAxis(const Vector3D& fp0) : Axis(fp0) {}
 RadialAxis::RadialAxis(const nlohmann::json& config) : Axis(config) {}
 
 double RadialAxis::GetDepth(const Vector3D& xi) const {
-    return (xi - fp0_).magnitude();
+    return (Vec3(xi) - Vec3(fp0_)).magnitude();
 }
 
 double RadialAxis::GetEffectiveDistance(const Vector3D& xi, const Vector3D& direction) const {
-    Cartesian3D aux{Cartesian3D(xi) - fp0_};
+    auto aux = Vec3(xi) - Vec3(fp0_);
     aux.normalize();
 
-    return -aux * direction;
+    return -aux * Vec3(direction);
 }
 
 // %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -132,14 +133,14 @@ bool CartesianAxis::operator!=(const CartesianAxis& axis) const {
 }
 
 double CartesianAxis::GetDepth(const Vector3D& xi) const {
-    return fAxis_ * (xi - fp0_);
+    return Vec3(fAxis_) * (Vec3(xi) - Vec3(fp0_));
 }
 
 double CartesianAxis::GetEffectiveDistance(const Vector3D& xi,
                                            const Vector3D& direction) const {
     (void)xi;
 
-    return fAxis_ * direction;
+    return Vec3(fAxis_) * Vec3(direction);
 }
 
 std::shared_ptr<Density_distr> PROPOSAL::CreateDensityDistribution(const nlohmann::json& config) {
@@ -1,4 +1,5 @@
 
+#include <cmath>
 #include <functional>
 #include "PROPOSAL/math/MathMethods.h"
 #include "PROPOSAL/density_distr/density_polynomial.h"
@@ -66,20 +67,32 @@ double Density_polynomial::Correct(const Vector3D& xi,
                                    const Vector3D& direction,
                                    double res,
                                    double distance_to_border) const {
-    auto F = [&](double l) {return Helper_function(xi, direction, res, l);};
-    auto dF = [&](double l) {return helper_function(xi, direction, res, l);};
-
-    // check if direction * axis larger or less than zero
-    // direction * fAxis_
+    auto delta = axis_->GetEffectiveDistance(xi, direction);
+    if (delta == 0)
+        throw DensityException("Next interaction point lies in infinite.");
 
+    // Solve for the depth with the requested antiderivative instead of the
+    // distance, so the iteration only evaluates the polynomials and not the
+    // axis. The cumulative grammage at xi is only calculated once.
+    auto depth = axis_->GetDepth(xi);
+    auto target = antiderived_density_distribution(depth) +
+                  res * delta * delta / massDensity_;
+    auto F = [&](double d) {
+        return antiderived_density_distribution(d) - target;
+    };
+    auto dF = [&](double d) { return density_distribution(d); };
+
+    auto depth_border = depth + distance_to_border * delta;
+    double depth_final;
     try {
-        res =
-            NewtonRaphson(F, dF, 0, distance_to_border, distance_to_border / 2);
+        depth_final = NewtonRaphson(F, dF, depth, depth_border,
+                                    0.5 * (depth + depth_border), 101,
+                                    1.e-6 * std::abs(delta));
     } catch (MathException& e) {
         throw DensityException("Next interaction point lies in infinite.");
     }
 
-    return res;
+    return (depth_final - depth) / delta;
 }
 
 double Density_polynomial::Integrate(const Vector3D& xi,
@@ -1,4 +1,6 @@
 
+#include <algorithm>
+#include <cmath>
 #include <functional>
 #include "PROPOSAL/density_distr/density_splines.h"
 #include "PROPOSAL/medium/Medium.h"
@@ -12,6 +14,7 @@ Density_splines::Density_splines(const Axis& axis, const Spline& splines, double
       spline_(splines.clone()),
       integrated_spline_(splines.clone()) {
     integrated_spline_->Antiderivative(0);
+    init_grammage_nodes();
 }
 
 Density_splines::Density_splines(const PROPOSAL::Axis& axis, const PROPOSAL::Spline& splines, const Medium& medium)
@@ -19,8 +22,10 @@ Density_splines::Density_splines(const PROPOSAL::Axis& axis, const PROPOSAL::Spl
 
 Density_splines::Density_splines(const Density_splines& dens_splines)
     : Density_distr(dens_splines),
-      spline_(dens_splines.spline_),
-      integrated_spline_(dens_splines.integrated_spline_) {}
+      spline_(dens_splines.spline_->clone()),
+      integrated_spline_(dens_splines.integrated_spline_->clone()),
+      depth_nodes_(dens_splines.depth_nodes_),
+      grammage_nodes_(dens_splines.grammage_nodes_) {}
 
 Density_splines::Density_splines(const nlohmann::json& config) : Density_distr(config) {
     if(!config.contains("spline_type"))
@@ -36,16 +41,31 @@ Density_splines::Density_splines(const nlohmann::json& config) : Density_distr(c
         throw std::invalid_argument("Density_splines: Type of spline must be linear or cubic");
     }
     integrated_spline_->Antiderivative(0);
+    init_grammage_nodes();
 }
 
+void Density_splines::init_grammage_nodes() {
+    depth_nodes_ = integrated_spline_->GetSubintervalls();
+    grammage_nodes_.resize(depth_nodes_.size());
+    for (unsigned int i = 0; i < depth_nodes_.size(); ++i)
+        grammage_nodes_[i] = integrated_spline_->evaluate(depth_nodes_[i]);
+
+    auto increasing = std::adjacent_find(grammage_nodes_.begin(),
+                                         grammage_nodes_.end(),
+                                         std::greater_equal<double>());
+    if (increasing != grammage_nodes_.end()) {
+        depth_nodes_.clear();
+        grammage_nodes_.clear();
+    }
+}
 
 bool Density_splines::compare(const Density_distr& dens_distr) const {
     const Density_splines* dens_splines= dynamic_cast<const Density_splines*>(&dens_distr);
     if(!dens_splines)
         return false;
-    if( spline_!= dens_splines->spline_)
+    if( *spline_ != *dens_splines->spline_)
         return false;
-    if( integrated_spline_!= dens_splines->integrated_spline_)
+    if( *integrated_spline_ != *dens_splines->integrated_spline_)
         return false;
     return true;
 }
@@ -70,8 +90,75 @@ double Density_splines::Correct(const Vector3D& xi,
                                 const Vector3D& direction,
                                 double res,
                                 double distance_to_border) const {
-    auto F = [&](double l) {return Helper_function(xi, direction, res, l);};
-    auto dF = [&](double l) {return helper_function(xi, direction, res, l);};
+    auto delta = axis_->GetEffectiveDistance(xi, direction);
+    if (delta == 0)
+        throw DensityException("Next interaction point lies in infinite.");
+
+    // The grammage after the distance l is determined by the antiderivative
+    // at the depth + l * delta. The subintervall containing the depth with
+    // the requested antiderivative is looked up in the tabulated nodes,
+    // inside of it the root of a single polynomial has to be found.
+    auto depth = axis_->GetDepth(xi);
+    auto target = integrated_spline_->evaluate(depth) +
+                  res * delta * delta / massDensity_;
+    if (grammage_nodes_.empty() || target < grammage_nodes_.front() ||
+        target > grammage_nodes_.back())
+        return correct_iterative(xi, direction, res, distance_to_border);
+
+    auto it = std::upper_bound(grammage_nodes_.begin() + 1,
+                               grammage_nodes_.end() - 1, target);
+    unsigned int segment = it - grammage_nodes_.begin() - 1;
+    auto low = depth_nodes_[segment];
+    auto up = depth_nodes_[segment + 1];
+
+    auto F = [&](double d) {
+        return integrated_spline_->evaluate_with_hint(d, segment) - target;
+    };
+    auto dF = [&](double d) {
+        return spline_->evaluate_with_hint(d, segment);
+    };
+
+    double depth_final;
+    try {
+        depth_final = NewtonRaphson(F, dF, low, up, 0.5 * (low + up), 101,
+                                    1.e-6 * std::abs(delta));
+    } catch (MathException& e) {
+        throw DensityException("Next interaction point lies in infinite.");
+    }
+
+    auto distance = (depth_final - depth) / delta;
+    if (distance < 0 || distance > distance_to_border)
+        throw DensityException("Next interaction point lies in infinite.");
+    return distance;
+}
+
+double Density_splines::correct_iterative(const Vector3D& xi,
+                                          const Vector3D& direction,
+                                          double res,
+                                          double distance_to_border) const {
+    // Same as Helper_function and helper_function, but the quantities at
+    // xi are calculated once and the segments of the splines are kept
+    // between the iterations, which move along the track.
+    auto dir_cartesian = Cartesian3D(direction);
+    auto delta = axis_->GetEffectiveDistance(xi, direction);
+    auto depth = axis_->GetDepth(xi);
+    auto integral_start = Integrate(xi, direction, 0);
+    auto density_start = Evaluate(xi);
+    auto segment_integral = 0u;
+    auto segment_density = 0u;
+
+    auto F = [&](double l) {
+        return integral_start - massDensity_ / (delta * delta) *
+                   integrated_spline_->evaluate_with_hint(depth + l * delta,
+                                                          segment_integral) +
+               res;
+    };
+    auto dF = [&](double l) {
+        return density_start -
+               massDensity_ * spline_->evaluate_with_hint(
+                                  axis_->GetDepth(xi + l * dir_cartesian),
+                                  segment_density);
+    };
 
     try {
         res =
@@ -5,6 +5,7 @@
 #include "PROPOSAL/Constants.h"
 #include "PROPOSAL/Logging.h"
 #include "PROPOSAL/geometry/Box.h"
+#include "PROPOSAL/math/Vec3.h"
 #include <nlohmann/json.hpp>
 
 using namespace PROPOSAL;
@@ -64,20 +65,20 @@ std::pair<double, double> Box::DistanceToBorder(const Vector3D& position, const
 {
     // Calculate intersection of particle trajectory and the box
     // Surface of the box is defined by six planes:
-    // E1: x1   =   pos_vec.GetX() + 0.5*x
-    // E2: x1   =   pos_vec.GetX() - 0.5*x
-    // E3: x2   =   pos_vec.GetY() + 0.5*y
-    // E4: x2   =   pos_vec.GetY() - 0.5*y
-    // E5: x3   =   pos_vec.GetZ() + 0.5*z
-    // E6: x3   =   pos_vec.GetZ() - 0.5*z
+    // E1: x1   =   pos_vec.x + 0.5*x
+    // E2: x1   =   pos_vec.x - 0.5*x
+    // E3: x2   =   pos_vec.y + 0.5*y
+    // E4: x2   =   pos_vec.y - 0.5*y
+    // E5: x3   =   pos_vec.z + 0.5*z
+    // E6: x3   =   pos_vec.z - 0.5*z
     // straight line (particle trajectory) g = vec(x,y,z) + t * dir_vec( cosph
     // *sinth, sinph *sinth , costh)
     // We are only interested in postive values of t
     // ( we want to find the intersection in direction of the particle
     // trajectory)
 
-    auto dir_vec = Cartesian3D(direction);
-    auto pos_vec = Cartesian3D(position);
+    auto dir_vec = Vec3(direction);
+    auto pos_vec = Vec3(position);
 
     std::pair<double, double> distance;
     double t;
@@ -95,9 +96,9 @@ std::pair<double, double> Box::DistanceToBorder(const Vector3D& position, const
     double z_calc_neg = position_.GetZ() - 0.5 * z_;
 
     // intersection with E1
-    if (dir_vec.GetX() != 0) // if dir_vec == 0 particle trajectory is parallel to E1
+    if (dir_vec.x != 0) // if dir_vec == 0 particle trajectory is parallel to E1
     {
-        t = (x_calc_pos - pos_vec.GetX()) / dir_vec.GetX();
+        t = (x_calc_pos - pos_vec.x) / dir_vec.x;
 
         // Computer precision controll
         if (t > 0 && t < GEOMETRY_PRECISION)
@@ -106,8 +107,8 @@ std::pair<double, double> Box::DistanceToBorder(const Vector3D& position, const
         if (t > 0) // Interection is in particle trajectory direction
         {
             // Check if intersection is inside the box borders
-            intersection_y = pos_vec.GetY() + t * dir_vec.GetY();
-            intersection_z = pos_vec.GetZ() + t * dir_vec.GetZ();
+            intersection_y = pos_vec.y + t * dir_vec.y;
+            intersection_z = pos_vec.z + t * dir_vec.z;
             if (intersection_y >= y_calc_neg && intersection_y <= y_calc_pos && intersection_z >= z_calc_neg &&
                 intersection_z <= z_calc_pos)
             {
@@ -117,9 +118,9 @@ std::pair<double, double> Box::DistanceToBorder(const Vector3D& position, const
     }
 
     // intersection with E2
-    if (dir_vec.GetX() != 0) // if dir_vec == 0 particle trajectory is parallel to E2
+    if (dir_vec.x != 0) // if dir_vec == 0 particle trajectory is parallel to E2
     {
-        t = (x_calc_neg - pos_vec.GetX()) / dir_vec.GetX();
+        t = (x_calc_neg - pos_vec.x) / dir_vec.x;
 
         // Computer precision controll
         if (t > 0 && t < GEOMETRY_PRECISION)
@@ -128,8 +129,8 @@ std::pair<double, double> Box::DistanceToBorder(const Vector3D& position, const
         if (t > 0) // Interection is in particle trajectory direction
         {
             // Check if intersection is inside the box borders
-            intersection_y = pos_vec.GetY() + t * dir_vec.GetY();
-            intersection_z = pos_vec.GetZ() + t * dir_vec.GetZ();
+            intersection_y = pos_vec.y + t * dir_vec.y;
+            intersection_z = pos_vec.z + t * dir_vec.z;
             if (intersection_y >= y_calc_neg && intersection_y <= y_calc_pos && intersection_z >= z_calc_neg &&
                 intersection_z <= z_calc_pos)
             {
@@ -139,9 +140,9 @@ std::pair<double, double> Box::DistanceToBorder(const Vector3D& position, const
     }
 
     // intersection with E3
-    if (dir_vec.GetY() != 0) // if dir_vec == 0 particle trajectory is parallel to E3
+    if (dir_vec.y != 0) // if dir_vec == 0 particle trajectory is parallel to E3
     {
-        t = (y_calc_pos - pos_vec.GetY()) / dir_vec.GetY();
+        t = (y_calc_pos - pos_vec.y) / dir_vec.y;
 
         // Computer precision controll
         if (t > 0 && t < GEOMETRY_PRECISION)
@@ -150,8 +151,8 @@ std::pair<double, double> Box::DistanceToBorder(const Vector3D& position, const
         if (t > 0) // Interection is in particle trajectory direction
         {
             // Check if intersection is inside the box borders
-            intersection_x = pos_vec.GetX() + t * dir_vec.GetX();
-            intersection_z = pos_vec.GetZ() + t * dir_vec.GetZ();
+            intersection_x = pos_vec.x + t * dir_vec.x;
+            intersection_z = pos_vec.z + t * dir_vec.z;
             if (intersection_x >= x_calc_neg && intersection_x <= x_calc_pos && intersection_z >= z_calc_neg &&
                 intersection_z <= z_calc_pos)
             {
@@ -161,9 +162,9 @@ std::pair<double, double> Box::DistanceToBorder(const Vector3D& position, const
     }
 
     // intersection with E4
-    if (dir_vec.GetY() != 0) // if dir_vec == 0 particle trajectory is parallel to E4
+    if (dir_vec.y != 0) // if dir_vec == 0 particle trajectory is parallel to E4
     {
-        t = (y_calc_neg - pos_vec.GetY()) / dir_vec.GetY();
+        t = (y_calc_neg - pos_vec.y) / dir_vec.y;
 
         // Computer precision controll
         if (t > 0 && t < GEOMETRY_PRECISION)
@@ -172,8 +173,8 @@ std::pair<double, double> Box::DistanceToBorder(const Vector3D& position, const
         if (t > 0) // Interection is in particle trajectory direction
         {
             // Check if intersection is inside the box borders
-            intersection_x = pos_vec.GetX() + t * dir_vec.GetX();
-            intersection_z = pos_vec.GetZ() + t * dir_vec.GetZ();
+            intersection_x = pos_vec.x + t * dir_vec.x;
+            intersection_z = pos_vec.z + t * dir_vec.z;
             if (intersection_x >= x_calc_neg && intersection_x <= x_calc_pos && intersection_z >= z_calc_neg &&
                 intersection_z <= z_calc_pos)
             {
@@ -183,9 +184,9 @@ std::pair<double, double> Box::DistanceToBorder(const Vector3D& position, const
     }
 
     // intersection with E5
-    if (dir_vec.GetZ() != 0) // if dir_vec == 0 particle trajectory is parallel to E5
+    if (dir_vec.z != 0) // if dir_vec == 0 particle trajectory is parallel to E5
     {
-        t = (z_calc_pos - pos_vec.GetZ()) / dir_vec.GetZ();
+        t = (z_calc_pos - pos_vec.z) / dir_vec.z;
 
         // Computer precision controll
         if (t > 0 && t < GEOMETRY_PRECISION)
@@ -194,8 +195,8 @@ std::pair<double, double> Box::DistanceToBorder(const Vector3D& position, const
         if (t > 0) // Interection is in particle trajectory direction
         {
             // Check if intersection is inside the box borders
-            intersection_x = pos_vec.GetX() + t * dir_vec.GetX();
-            intersection_y = pos_vec.GetY() + t * dir_vec.GetY();
+            intersection_x = pos_vec.x + t * dir_vec.x;
+            intersection_y = pos_vec.y + t * dir_vec.y;
             if (intersection_x >= x_calc_neg && intersection_x <= x_calc_pos && intersection_y >= y_calc_neg &&
                 intersection_y <= y_calc_pos)
             {
@@ -205,9 +206,9 @@ std::pair<double, double> Box::DistanceToBorder(const Vector3D& position, const
     }
 
     // intersection with E6
-    if (dir_vec.GetZ() != 0) // if dir_vec == 0 particle trajectory is parallel to E6
+    if (dir_vec.z != 0) // if dir_vec == 0 particle trajectory is parallel to E6
     {
-        t = (z_calc_neg - pos_vec.GetZ()) / dir_vec.GetZ();
+        t = (z_calc_neg - pos_vec.z) / dir_vec.z;
 
         // Computer precision controll
         if (t > 0 && t < GEOMETRY_PRECISION)
@@ -216,8 +217,8 @@ std::pair<double, double> Box::DistanceToBorder(const Vector3D& position, const
         if (t > 0) // Interection is in particle trajectory direction
         {
             // Check if intersection is inside the box borders
-            intersection_x = pos_vec.GetX() + t * dir_vec.GetX();
-            intersection_y = pos_vec.GetY() + t * dir_vec.GetY();
+            intersection_x = pos_vec.x + t * dir_vec.x;
+            intersection_y = pos_vec.y + t * dir_vec.y;
             if (intersection_x >= x_calc_neg && intersection_x <= x_calc_pos && intersection_y >= y_calc_neg &&
                 intersection_y <= y_calc_pos)
             {
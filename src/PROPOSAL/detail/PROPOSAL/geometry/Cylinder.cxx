@@ -1,10 +1,11 @@
 
+#include <array>
 #include <cmath>
-#include <vector>
 
 #include "PROPOSAL/Constants.h"
 #include "PROPOSAL/Logging.h"
 #include "PROPOSAL/geometry/Cylinder.h"
+#include "PROPOSAL/math/Vec3.h"
 #include <nlohmann/json.hpp>
 
 using namespace PROPOSAL;
@@ -87,8 +88,8 @@ std::pair<double, double> Cylinder::DistanceToBorder(const Vector3D& position, c
     // inside
 
     double A, B, C, t1, t2, t;
-    auto dir_vec = Cartesian3D(direction);
-    auto pos_vec = Cartesian3D(position);
+    auto dir_vec = Vec3(direction);
+    auto pos_vec = Vec3(position);
 
     double determinant;
 
@@ -96,25 +97,27 @@ std::pair<double, double> Cylinder::DistanceToBorder(const Vector3D& position, c
     double intersection_y;
     double intersection_z;
 
-    std::vector<double> dist;
+    // at most two intersections with the barrel and two with the surfaces
+    std::array<double, 4> dist;
+    size_t n_dist = 0;
 
     std::pair<double, double> distance;
 
     double z_calc_pos = position_.GetZ() + 0.5 * z_;
     double z_calc_neg = position_.GetZ() - 0.5 * z_;
 
-    if (!(dir_vec.GetX() == 0 && dir_vec.GetY() == 0)) // Otherwise the particle
+    if (!(dir_vec.x == 0 && dir_vec.y == 0)) // Otherwise the particle
                                              // trajectory is parallel to
                                              // cylinder barrel
     {
 
-        A = std::pow((pos_vec.GetX() - position_.GetX()), 2) +
-            std::pow((pos_vec.GetY() - position_.GetY()), 2) -
+        A = std::pow((pos_vec.x - position_.GetX()), 2) +
+            std::pow((pos_vec.y - position_.GetY()), 2) -
             radius_*radius_;
 
-        B = 2 * ((pos_vec.GetX() - position_.GetX()) * dir_vec.GetX() + (pos_vec.GetY() - position_.GetY()) * dir_vec.GetY());
+        B = 2 * ((pos_vec.x - position_.GetX()) * dir_vec.x + (pos_vec.y - position_.GetY()) * dir_vec.y);
 
-        C = dir_vec.GetX() * dir_vec.GetX() + dir_vec.GetY() * dir_vec.GetY();
+        C = dir_vec.x * dir_vec.x + dir_vec.y * dir_vec.y;
 
         B /= C;
         A /= C;
@@ -134,21 +137,21 @@ std::pair<double, double> Cylinder::DistanceToBorder(const Vector3D& position, c
 
             if (t1 > 0)
             {
-                intersection_z = pos_vec.GetZ() + t1 * dir_vec.GetZ();
+                intersection_z = pos_vec.z + t1 * dir_vec.z;
                 // is inside the borders
                 if (intersection_z > z_calc_neg && intersection_z < z_calc_pos)
                 {
-                    dist.push_back(t1);
+                    dist[n_dist++] = t1;
                 }
             }
 
             if (t2 > 0)
             {
-                intersection_z = pos_vec.GetZ() + t2 * dir_vec.GetZ();
+                intersection_z = pos_vec.z + t2 * dir_vec.z;
                 // is inside the borders
                 if (intersection_z > z_calc_neg && intersection_z < z_calc_pos)
                 {
-                    dist.push_back(t2);
+                    dist[n_dist++] = t2;
                 }
             }
         }
@@ -157,21 +160,21 @@ std::pair<double, double> Cylinder::DistanceToBorder(const Vector3D& position, c
     // if we have found already to intersections we don't have to check for
     // intersections
     // with top or bottom surface
-    if (dist.size() < 2)
+    if (n_dist < 2)
     {
         // intersection with E1
-        if (dir_vec.GetZ() != 0) // if dir_vec == 0 particle trajectory is parallel
+        if (dir_vec.z != 0) // if dir_vec == 0 particle trajectory is parallel
                             // to E1 (Should not happen)
         {
-            t = (z_calc_pos - pos_vec.GetZ()) / dir_vec.GetZ();
+            t = (z_calc_pos - pos_vec.z) / dir_vec.z;
             // Computer precision controll
             if (t > 0 && t < GEOMETRY_PRECISION)
                 t = 0;
 
             if (t > 0) // Interection is in particle trajectory direction
             {
-                intersection_x = pos_vec.GetX() + t * dir_vec.GetX();
-                intersection_y = pos_vec.GetY() + t * dir_vec.GetY();
+                intersection_x = pos_vec.x + t * dir_vec.x;
+                intersection_y = pos_vec.y + t * dir_vec.y;
 
                 if (std::sqrt(std::pow((intersection_x - position_.GetX()), 2) +
                     std::pow((intersection_y - position_.GetY()), 2)) <=
@@ -180,16 +183,16 @@ std::pair<double, double> Cylinder::DistanceToBorder(const Vector3D& position, c
                     std::pow((intersection_y - position_.GetY()), 2)) >=
                         inner_radius_)
                 {
-                    dist.push_back(t);
+                    dist[n_dist++] = t;
                 }
             }
         }
 
         // intersection with E2
-        if (dir_vec.GetZ() != 0) // if dir_vec == 0 particle trajectory is parallel
+        if (dir_vec.z != 0) // if dir_vec == 0 particle trajectory is parallel
                             // to E2 (Should not happen)
         {
-            t = (z_calc_neg - pos_vec.GetZ()) / dir_vec.GetZ();
+            t = (z_calc_neg - pos_vec.z) / dir_vec.z;
 
             // Computer precision controll
             if (t > 0 && t < GEOMETRY_PRECISION)
@@ -197,8 +200,8 @@ std::pair<double, double> Cylinder::DistanceToBorder(const Vector3D& position, c
 
             if (t > 0) // Interection is in particle trajectory direction
             {
-                intersection_x = pos_vec.GetX() + t * dir_vec.GetX();
-                intersection_y = pos_vec.GetY() + t * dir_vec.GetY();
+                intersection_x = pos_vec.x + t * dir_vec.x;
+                intersection_y = pos_vec.y + t * dir_vec.y;
 
                 if (std::sqrt(std::pow((intersection_x - position_.GetX()), 2) +
                     std::pow((intersection_y - position_.GetY()), 2)) <=
@@ -207,26 +210,26 @@ std::pair<double, double> Cylinder::DistanceToBorder(const Vector3D& position, c
                     std::pow((intersection_y - position_.GetY()), 2)) >=
                         inner_radius_)
                 {
-                    dist.push_back(t);
+                    dist[n_dist++] = t;
                 }
             }
         }
     }
     // No intersection with the outer cylinder
-    if (dist.size() < 1)
+    if (n_dist < 1)
     {
         distance.first  = -1;
         distance.second = -1;
         //    return distance;
-    } else if (dist.size() == 1) // particle is inside the cylinder
+    } else if (n_dist == 1) // particle is inside the cylinder
     {
-        distance.first  = dist.at(0);
+        distance.first  = dist[0];
         distance.second = -1;
 
-    } else if (dist.size() == 2) // cylinder is infront of the particle
+    } else if (n_dist == 2) // cylinder is infront of the particle
     {
-        distance.first  = dist.at(0);
-        distance.second = dist.at(1);
+        distance.first  = dist[0];
+        distance.second = dist[1];
 
         if (distance.second < distance.first)
         {
@@ -243,17 +246,17 @@ std::pair<double, double> Cylinder::DistanceToBorder(const Vector3D& position, c
 
     if (inner_radius_ > 0)
     {
-        if (!(dir_vec.GetX() == 0 && dir_vec.GetY() == 0))
+        if (!(dir_vec.x == 0 && dir_vec.y == 0))
         {
 
-            A = std::pow((pos_vec.GetX() - position_.GetX()), 2) +
-                std::pow((pos_vec.GetY() - position_.GetY()), 2) -
+            A = std::pow((pos_vec.x - position_.GetX()), 2) +
+                std::pow((pos_vec.y - position_.GetY()), 2) -
                 inner_radius_*inner_radius_;
 
             B = 2 *
-                ((pos_vec.GetX() - position_.GetX()) * dir_vec.GetX() + (pos_vec.GetY() - position_.GetY()) * dir_vec.GetY());
+                ((pos_vec.x - position_.GetX()) * dir_vec.x + (pos_vec.y - position_.GetY()) * dir_vec.y);
 
-            C = dir_vec.GetX() * dir_vec.GetX() + dir_vec.GetY() * dir_vec.GetY();
+            C = dir_vec.x * dir_vec.x + dir_vec.y * dir_vec.y;
 
             B /= C;
             A /= C;
@@ -283,7 +286,7 @@ std::pair<double, double> Cylinder::DistanceToBorder(const Vector3D& position, c
                 {
                     if (t1 > 0)
                     {
-                        intersection_z = pos_vec.GetZ() + t1 * dir_vec.GetZ();
+                        intersection_z = pos_vec.z + t1 * dir_vec.z;
                         // is inside the borders
                         if (intersection_z > z_calc_neg && intersection_z < z_calc_pos)
                         {
@@ -294,7 +297,7 @@ std::pair<double, double> Cylinder::DistanceToBorder(const Vector3D& position, c
 
                     if (t2 > 0)
                     {
-                        intersection_z = pos_vec.GetZ() + t2 * dir_vec.GetZ();
+                        intersection_z = pos_vec.z + t2 * dir_vec.z;
                         // is inside the borders
                         if (intersection_z > z_calc_neg && intersection_z < z_calc_pos)
                         {
@@ -320,7 +323,7 @@ std::pair<double, double> Cylinder::DistanceToBorder(const Vector3D& position, c
                 {
                     if (t1 > 0)
                     {
-                        intersection_z = pos_vec.GetZ() + t1 * dir_vec.GetZ();
+                        intersection_z = pos_vec.z + t1 * dir_vec.z;
                         // is inside the borders
                         if (intersection_z > z_calc_neg && intersection_z < z_calc_pos)
                         {
@@ -329,7 +332,7 @@ std::pair<double, double> Cylinder::DistanceToBorder(const Vector3D& position, c
                     }
                     if (t2 > 0)
                     {
-                        intersection_z = pos_vec.GetZ() + t2 * dir_vec.GetZ();
+                        intersection_z = pos_vec.z + t2 * dir_vec.z;
                         // is inside the borders
                         if (intersection_z > z_calc_neg && intersection_z < z_calc_pos)
                         {
@@ -357,17 +360,17 @@ std::pair<double, double> Cylinder::DistanceToBorder(const Vector3D& position, c
                         // |     |      |     |
                         // |_____|      |_____|
                         //
-                        if (pos_vec.GetZ() >= z_calc_neg && pos_vec.GetZ() <= z_calc_pos &&
-                            std::sqrt(std::pow((pos_vec.GetX() - position_.GetX()), 2) +
-                            std::pow((pos_vec.GetY() - position_.GetY()), 2)) <=
+                        if (pos_vec.z >= z_calc_neg && pos_vec.z <= z_calc_pos &&
+                            std::sqrt(std::pow((pos_vec.x - position_.GetX()), 2) +
+                            std::pow((pos_vec.y - position_.GetY()), 2)) <=
                                 radius_ + GEOMETRY_PRECISION &&
-                            std::sqrt(std::pow((pos_vec.GetX() - position_.GetX()), 2) +
-                            std::pow((pos_vec.GetY() - position_.GetY()), 2)) >=
+                            std::sqrt(std::pow((pos_vec.x - position_.GetX()), 2) +
+                            std::pow((pos_vec.y - position_.GetY()), 2)) >=
                                 inner_radius_ - GEOMETRY_PRECISION)
                         {
                             if (t1 < distance.first)
                             {
-                                intersection_z = pos_vec.GetZ() + t1 * dir_vec.GetZ();
+                                intersection_z = pos_vec.z + t1 * dir_vec.z;
                                 // is inside the borders
                                 if (intersection_z > z_calc_neg && intersection_z < z_calc_pos)
                                 {
@@ -379,7 +382,7 @@ std::pair<double, double> Cylinder::DistanceToBorder(const Vector3D& position, c
                             }
                             if (t2 < distance.first)
                             {
-                                intersection_z = pos_vec.GetZ() + t2 * dir_vec.GetZ();
+                                intersection_z = pos_vec.z + t2 * dir_vec.z;
                                 // is inside the borders
                                 if (intersection_z > z_calc_neg && intersection_z < z_calc_pos)
                                 {
@@ -405,7 +408,7 @@ std::pair<double, double> Cylinder::DistanceToBorder(const Vector3D& position, c
                         //   x
                         else
                         {
-                            intersection_z = pos_vec.GetZ() + t1 * dir_vec.GetZ();
+                            intersection_z = pos_vec.z + t1 * dir_vec.z;
                             // is inside the borders
                             if (intersection_z > z_calc_neg && intersection_z < z_calc_pos)
                             {
@@ -416,7 +419,7 @@ std::pair<double, double> Cylinder::DistanceToBorder(const Vector3D& position, c
 
                             if (distance.second < 0)
                             {
-                                intersection_z = pos_vec.GetZ() + t2 * dir_vec.GetZ();
+                                intersection_z = pos_vec.z + t2 * dir_vec.z;
                                 // is inside the borders
                                 if (intersection_z > z_calc_neg && intersection_z < z_calc_pos)
                                 {
@@ -448,7 +451,7 @@ std::pair<double, double> Cylinder::DistanceToBorder(const Vector3D& position, c
                     {
                         if (t1 > 0)
                         {
-                            intersection_z = pos_vec.GetZ() + t1 * dir_vec.GetZ();
+                            intersection_z = pos_vec.z + t1 * dir_vec.z;
                             // is inside the borders
                             if (intersection_z > z_calc_neg && intersection_z < z_calc_pos)
                             {
@@ -457,7 +460,7 @@ std::pair<double, double> Cylinder::DistanceToBorder(const Vector3D& position, c
                             }
                         } else
                         {
-                            intersection_z = pos_vec.GetZ() + t2 * dir_vec.GetZ();
+                            intersection_z = pos_vec.z + t2 * dir_vec.z;
                             // is inside the borders
                             if (intersection_z > z_calc_neg && intersection_z < z_calc_pos)
                             {
@@ -473,7 +476,7 @@ std::pair<double, double> Cylinder::DistanceToBorder(const Vector3D& position, c
                         // The particle is moving into the inner cylinder
                         if (t2 > 0)
                         {
-                            intersection_z = pos_vec.GetZ() + t2 * dir_vec.GetZ();
+                            intersection_z = pos_vec.z + t2 * dir_vec.z;
                             // is inside the borders
                             if (intersection_z > z_calc_neg && intersection_z < z_calc_pos)
                             {
@@ -488,7 +491,7 @@ std::pair<double, double> Cylinder::DistanceToBorder(const Vector3D& position, c
                         // The particle is moving into the inner sphere
                         if (t1 > 0)
                         {
-                            intersection_z = pos_vec.GetZ() + t1 * dir_vec.GetZ();
+                            intersection_z = pos_vec.z + t1 * dir_vec.z;
                             // is inside the borders
                             if (intersection_z > z_calc_neg && intersection_z < z_calc_pos)
                             {
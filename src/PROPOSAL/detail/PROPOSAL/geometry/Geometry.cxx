@@ -87,78 +87,67 @@ bool Geometry::operator!=(const Geometry& geometry) const
 
 bool Geometry::IsInside(const Vector3D& position, const Vector3D& direction) const
 {
-    bool is_inside = false;
-
-    std::pair<double, double> dist = DistanceToBorder(position, direction);
-
-    if (dist.first > 0 && dist.second < 0)
-    {
-        is_inside = true;
-    }
-    return is_inside;
+    return GetLocation(DistanceToBorder(position, direction)) == ParticleLocation::InsideGeometry;
 }
 
 // ------------------------------------------------------------------------- //
 bool Geometry::IsInfront(const Vector3D& position, const Vector3D& direction) const
 {
-    bool is_infront = false;
-
-    std::pair<double, double> dist = DistanceToBorder(position, direction);
-
-    if (dist.first > 0 && dist.second > 0)
-    {
-        is_infront = true;
-    }
-    return is_infront;
+    return GetLocation(DistanceToBorder(position, direction)) == ParticleLocation::InfrontGeometry;
 }
 
 // ------------------------------------------------------------------------- //
 bool Geometry::IsBehind(const Vector3D& position, const Vector3D& direction) const
 {
-    bool is_behind = false;
-
-    std::pair<double, double> dist = DistanceToBorder(position, direction);
-
-    if (dist.first < 0 && dist.second < 0)
-    {
-        is_behind = true;
-    }
-    return is_behind;
+    return GetLocation(DistanceToBorder(position, direction)) == ParticleLocation::BehindGeometry;
 }
 
 // ------------------------------------------------------------------------- //
 bool Geometry::IsEntering(const Vector3D &position, const Vector3D &direction) const {
-    auto dist_forward = DistanceToBorder(position, direction);
-    auto dist_backward = DistanceToBorder(position, -Cartesian3D(direction));
-    if (dist_forward.first >= 0 && dist_forward.second == -1) {
-        if (dist_backward.first == -1 && dist_backward.second == -1) {
-            return true;
-        }
-    }
-    return false;
+    return GetIntersections(position, direction).is_entering;
 }
 
 // ------------------------------------------------------------------------- //
 bool Geometry::IsLeaving(const Vector3D &position, const Vector3D &direction) const {
-    auto dist_forward = DistanceToBorder(position, direction);
-    auto dist_backward = DistanceToBorder(position, -Cartesian3D(direction));
-    if (dist_forward.first == -1 && dist_forward.second == -1) {
-        if (dist_backward.first >= 0 && dist_backward.second == -1) {
-            return true;
-        }
-    }
-    return false;
+    return GetIntersections(position, direction).is_leaving;
 }
 
 Geometry::ParticleLocation::Enum Geometry::GetLocation(const Vector3D& position, const Vector3D& direction) const {
-    if(IsInfront(position, direction))
+    return GetLocation(DistanceToBorder(position, direction));
+}
+
+Geometry::ParticleLocation::Enum Geometry::GetLocation(const std::pair<double, double>& dist) {
+    if (dist.first > 0 && dist.second > 0)
         return Geometry::ParticleLocation::InfrontGeometry;
-    if(IsInside(position, direction))
+    if (dist.first > 0 && dist.second < 0)
         return Geometry::ParticleLocation::InsideGeometry;
     else
         return Geometry::ParticleLocation::BehindGeometry;
 }
 
+// ------------------------------------------------------------------------- //
+std::array<std::pair<double, double>, 2> Geometry::DistancesToBorder(const Vector3D& position, const Vector3D& direction) const
+{
+    return { DistanceToBorder(position, direction), DistanceToBorder(position, -Cartesian3D(direction)) };
+}
+
+Geometry::Intersections Geometry::GetIntersections(const Vector3D& position, const Vector3D& direction) const
+{
+    auto dist = DistancesToBorder(position, direction);
+    auto& dist_forward = dist[0];
+    auto& dist_backward = dist[1];
+
+    Intersections intersections;
+    intersections.forward = dist_forward;
+    intersections.backward = dist_backward;
+    intersections.location = GetLocation(dist_forward);
+    intersections.is_entering = dist_forward.first >= 0 && dist_forward.second == -1
+        && dist_backward.first == -1 && dist_backward.second == -1;
+    intersections.is_leaving = dist_forward.first == -1 && dist_forward.second == -1
+        && dist_backward.first >= 0 && dist_backward.second == -1;
+    return intersections;
+}
+
 // ------------------------------------------------------------------------- //
 double Geometry::DistanceToClosestApproach(const Vector3D& position, const Vector3D& direction) const
 {
@@ -45,6 +45,8 @@ std::shared_ptr<Geometry> CreateGeometry(const nlohmann::json& config){
             return std::make_shared<Box>(config);
         } else if (shape == "cylinder") {
             return std::make_shared<Cylinder>(config);
+        } else if (shape == "mesh") {
+            return std::make_shared<Mesh>(config);
         } else {
             throw std::invalid_argument("Unknown parameter 'shape' in geometry.");
         }
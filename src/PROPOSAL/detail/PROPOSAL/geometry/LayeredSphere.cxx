@@ -0,0 +1,87 @@
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <stdexcept>
+#include <utility>
+
+#include "PROPOSAL/Constants.h"
+#include "PROPOSAL/geometry/LayeredSphere.h"
+#include "PROPOSAL/geometry/Sphere.h"
+#include "PROPOSAL/math/Vec3.h"
+
+using namespace PROPOSAL;
+
+LayeredSphere::LayeredSphere(const Vector3D& position, std::vector<double> radii)
+    : Geometry("LayeredSphere", position)
+    , radii_(std::move(radii))
+{
+    if (radii_.size() < 2)
+        throw std::invalid_argument("LayeredSphere: at least two radii are required.");
+    if (radii_.front() < 0)
+        throw std::invalid_argument("LayeredSphere: radii must be >= 0.");
+    if (std::adjacent_find(radii_.begin(), radii_.end(), std::greater_equal<double>()) != radii_.end())
+        throw std::invalid_argument("LayeredSphere: radii must be strictly increasing.");
+}
+
+bool LayeredSphere::compare(const Geometry& geometry) const
+{
+    const LayeredSphere* layered_sphere = dynamic_cast<const LayeredSphere*>(&geometry);
+
+    if (!layered_sphere)
+        return false;
+    return radii_ == layered_sphere->radii_;
+}
+
+// ------------------------------------------------------------------------- //
+void LayeredSphere::print(std::ostream& os) const
+{
+    os << "Radii:";
+    for (auto radius : radii_)
+        os << '\t' << radius;
+    os << '\n';
+}
+
+// ------------------------------------------------------------------------- //
+std::pair<double, double> LayeredSphere::DistanceToBorder(const Vector3D& position, const Vector3D& direction) const
+{
+    return Sphere(position_, radii_.back(), radii_.front()).DistanceToBorder(position, direction);
+}
+
+// ------------------------------------------------------------------------- //
+size_t LayeredSphere::find_layer(double radius) const
+{
+    auto it = std::upper_bound(radii_.begin() + 1, radii_.end() - 1, radius);
+    return it - radii_.begin() - 1;
+}
+
+size_t LayeredSphere::GetLayer(const Vector3D& position) const
+{
+    return find_layer((Vec3(position) - Vec3(position_)).magnitude());
+}
+
+// ------------------------------------------------------------------------- //
+double LayeredSphere::DistanceToLayerBorder(const Vector3D& position, const Vector3D& direction) const
+{
+    // Same quadratic equation as in Sphere::DistanceToBorder for every radius
+    // which can be reached first, i.e. the borders of the enclosing layer.
+    // Their neighbours are included for positions on a border.
+    auto difference = Vec3(position) - Vec3(position_);
+    auto difference_length_squared = difference * difference;
+    auto B = difference * Vec3(direction);
+
+    auto layer = find_layer(std::sqrt(difference_length_squared));
+    auto first = layer > 0 ? layer - 1 : 0;
+    auto last = std::min(layer + 3, radii_.size());
+
+    auto distance = -1.;
+    for (auto i = first; i < last; ++i) {
+        auto determinant = B * B - (difference_length_squared - radii_[i] * radii_[i]);
+        if (determinant <= 0) // determinant == 0 (boundery point) is ignored
+            continue;
+        for (auto t : { -B - std::sqrt(determinant), -B + std::sqrt(determinant) }) {
+            if (t >= GEOMETRY_PRECISION && (distance < 0 || t < distance))
+                distance = t;
+        }
+    }
+    return distance;
+}
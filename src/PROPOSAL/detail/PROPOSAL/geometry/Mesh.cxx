@@ -0,0 +1,371 @@
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <functional>
+#include <limits>
+#include <numeric>
+#include <sstream>
+#include <stdexcept>
+
+#include "PROPOSAL/Constants.h"
+#include "PROPOSAL/geometry/Mesh.h"
+#include "PROPOSAL/math/Vec3.h"
+#include <nlohmann/json.hpp>
+
+using namespace PROPOSAL;
+
+namespace {
+constexpr unsigned int max_leaf_size = 4;
+
+using Vertices = std::vector<std::array<double, 3>>;
+using Triangles = std::vector<std::array<size_t, 3>>;
+
+// index of an OBJ face vertex like "7", "7/1" or "7//3", which may be
+// negative to count from the last vertex
+size_t obj_index(const std::string& token, size_t n_vertices)
+{
+    auto index = std::stol(token.substr(0, token.find('/')));
+    if (index < 0)
+        index += n_vertices + 1;
+    if (index < 1 || static_cast<size_t>(index) > n_vertices)
+        throw std::invalid_argument("Mesh: invalid vertex index in OBJ file.");
+    return index - 1;
+}
+
+void read_obj(std::istream& is, Vertices& vertices, Triangles& triangles)
+{
+    std::string line, keyword, token;
+    while (std::getline(is, line)) {
+        std::istringstream ss(line);
+        if (!(ss >> keyword))
+            continue;
+        if (keyword == "v") {
+            std::array<double, 3> v;
+            if (!(ss >> v[0] >> v[1] >> v[2]))
+                throw std::invalid_argument("Mesh: invalid vertex in OBJ file.");
+            vertices.push_back(v);
+        } else if (keyword == "f") {
+            // polygons are split into a fan of triangles
+            std::vector<size_t> face;
+            while (ss >> token)
+                face.push_back(obj_index(token, vertices.size()));
+            for (size_t i = 1; i + 1 < face.size(); ++i)
+                triangles.push_back({ face[0], face[i], face[i + 1] });
+        }
+    }
+}
+
+void read_ply(std::istream& is, Vertices& vertices, Triangles& triangles)
+{
+    struct Element {
+        std::string name;
+        size_t count;
+        std::vector<std::string> properties;
+    };
+    std::vector<Element> elements;
+
+    std::string line, keyword;
+    if (!std::getline(is, line) || line.compare(0, 3, "ply") != 0)
+        throw std::invalid_argument("Mesh: PLY file does not start with 'ply'.");
+    while (std::getline(is, line)) {
+        std::istringstream ss(line);
+        if (!(ss >> keyword) || keyword == "comment" || keyword == "obj_info")
+            continue;
+        if (keyword == "end_header")
+            break;
+        if (keyword == "format") {
+            std::string format;
+            ss >> format;
+            if (format != "ascii")
+                throw std::invalid_argument("Mesh: only ASCII PLY files are supported.");
+        } else if (keyword == "element") {
+            Element element;
+            ss >> element.name >> element.count;
+            elements.push_back(element);
+        } else if (keyword == "property" && !elements.empty()) {
+            std::string type, name;
+            ss >> type;
+            if (type == "list") {
+                std::string count_type, index_type;
+                ss >> count_type >> index_type;
+            }
+            ss >> name;
+            elements.back().properties.push_back(name);
+        }
+    }
+
+    for (auto const& element : elements) {
+        auto column = [&element](const std::string& name) {
+            auto it = std::find(element.properties.begin(), element.properties.end(), name);
+            return static_cast<size_t>(it - element.properties.begin());
+        };
+        auto x = column("x"), y = column("y"), z = column("z");
+        for (size_t i = 0; i < element.count; ++i) {
+            if (!std::getline(is, line))
+                throw std::invalid_argument("Mesh: unexpected end of PLY file.");
+            std::istringstream ss(line);
+            if (element.name == "vertex") {
+                std::vector<double> values;
+                double value;
+                while (ss >> value)
+                    values.push_back(value);
+                if (std::max({ x, y, z }) >= values.size())
+                    throw std::invalid_argument("Mesh: invalid vertex in PLY file.");
+                vertices.push_back({ values[x], values[y], values[z] });
+            } else if (element.name == "face") {
+                size_t n;
+                ss >> n;
+                std::vector<size_t> face(n);
+                for (auto& index : face)
+                    ss >> index;
+                if (!ss)
+                    throw std::invalid_argument("Mesh: invalid face in PLY file.");
+                for (size_t j = 1; j + 1 < face.size(); ++j)
+                    triangles.push_back({ face[0], face[j], face[j + 1] });
+            }
+        }
+    }
+}
+
+void read_mesh(const std::string& path, double scale, Vertices& vertices, Triangles& triangles)
+{
+    std::ifstream file(path);
+    if (!file)
+        throw std::invalid_argument("Mesh: unable to open file " + path + ".");
+
+    auto extension = path.substr(path.find_last_of('.') + 1);
+    std::transform(extension.begin(), extension.end(), extension.begin(), ::tolower);
+    if (extension == "obj")
+        read_obj(file, vertices, triangles);
+    else if (extension == "ply")
+        read_ply(file, vertices, triangles);
+    else
+        throw std::invalid_argument("Mesh: file format must be obj or ply.");
+
+    for (auto& vertex : vertices)
+        for (auto& c : vertex)
+            c *= scale;
+}
+
+struct Hit {
+    double t;
+    bool entering;
+};
+} // namespace
+
+Mesh::Mesh(const Vector3D& position, const Vertices& vertices, const Triangles& triangles)
+    : Geometry("Mesh", position)
+{
+    build(vertices, triangles);
+}
+
+Mesh::Mesh(const Vector3D& position, const std::string& path, double scale)
+    : Geometry("Mesh", position)
+{
+    Vertices vertices;
+    Triangles triangles;
+    read_mesh(path, scale, vertices, triangles);
+    build(vertices, triangles);
+}
+
+Mesh::Mesh(const nlohmann::json& config)
+    : Geometry(config)
+{
+    if(!config.contains("file") || !config["file"].is_string())
+        throw std::invalid_argument("No mesh file found.");
+
+    Vertices vertices;
+    Triangles triangles;
+    read_mesh(config["file"].get<std::string>(), config.value("scale", 1.), vertices, triangles);
+    build(vertices, triangles);
+}
+
+// ------------------------------------------------------------------------- //
+void Mesh::build(const Vertices& vertices, const Triangles& triangles)
+{
+    if (triangles.empty())
+        throw std::invalid_argument("Mesh: no triangles found.");
+    if (triangles.size() > std::numeric_limits<unsigned int>::max())
+        throw std::invalid_argument("Mesh: too many triangles.");
+    for (auto const& triangle : triangles)
+        for (auto index : triangle)
+            if (index >= vertices.size())
+                throw std::invalid_argument("Mesh: invalid vertex index.");
+
+    std::vector<std::array<double, 3>> centroid(triangles.size());
+    for (size_t i = 0; i < triangles.size(); ++i)
+        for (size_t k = 0; k < 3; ++k)
+            centroid[i][k] = (vertices[triangles[i][0]][k] + vertices[triangles[i][1]][k]
+                + vertices[triangles[i][2]][k]) / 3.;
+
+    std::vector<unsigned int> order(triangles.size());
+    std::iota(order.begin(), order.end(), 0);
+
+    // Top down construction. Every node is split at the median of the
+    // centroids along the axis of their largest extent.
+    nodes_.clear();
+    nodes_.reserve(2 * triangles.size() / max_leaf_size + 1);
+    std::function<void(size_t, size_t)> build_node = [&](size_t begin, size_t end) {
+        auto index = nodes_.size();
+        nodes_.emplace_back();
+
+        Node node;
+        node.lower.fill(std::numeric_limits<double>::infinity());
+        node.upper.fill(-std::numeric_limits<double>::infinity());
+        auto c_lower = node.lower;
+        auto c_upper = node.upper;
+        for (auto i = begin; i < end; ++i) {
+            for (size_t k = 0; k < 3; ++k) {
+                for (auto vertex : triangles[order[i]]) {
+                    node.lower[k] = std::min(node.lower[k], vertices[vertex][k]);
+                    node.upper[k] = std::max(node.upper[k], vertices[vertex][k]);
+                }
+                c_lower[k] = std::min(c_lower[k], centroid[order[i]][k]);
+                c_upper[k] = std::max(c_upper[k], centroid[order[i]][k]);
+            }
+        }
+
+        if (end - begin <= max_leaf_size) {
+            node.first = begin;
+            node.count = end - begin;
+            nodes_[index] = node;
+            return;
+        }
+
+        size_t axis = 0;
+        for (size_t k = 1; k < 3; ++k)
+            if (c_upper[k] - c_lower[k] > c_upper[axis] - c_lower[axis])
+                axis = k;
+        auto middle = begin + (end - begin) / 2;
+        std::nth_element(order.begin() + begin, order.begin() + middle, order.begin() + end,
+            [&centroid, axis](unsigned int a, unsigned int b) {
+                return centroid[a][axis] < centroid[b][axis];
+            });
+
+        // the left child directly follows its parent
+        build_node(begin, middle);
+        node.first = nodes_.size();
+        node.count = 0;
+        nodes_[index] = node;
+        build_node(middle, end);
+    };
+    build_node(0, triangles.size());
+
+    for (size_t k = 0; k < 3; ++k) {
+        v0_[k].resize(triangles.size());
+        e1_[k].resize(triangles.size());
+        e2_[k].resize(triangles.size());
+        for (size_t i = 0; i < triangles.size(); ++i) {
+            auto& triangle = triangles[order[i]];
+            v0_[k][i] = vertices[triangle[0]][k];
+            e1_[k][i] = vertices[triangle[1]][k] - vertices[triangle[0]][k];
+            e2_[k][i] = vertices[triangle[2]][k] - vertices[triangle[0]][k];
+        }
+    }
+}
+
+bool Mesh::compare(const Geometry& geometry) const
+{
+    const Mesh* mesh = dynamic_cast<const Mesh*>(&geometry);
+
+    if (!mesh)
+        return false;
+    else if (v0_ != mesh->v0_ || e1_ != mesh->e1_ || e2_ != mesh->e2_)
+        return false;
+    else
+        return true;
+}
+
+// ------------------------------------------------------------------------- //
+void Mesh::print(std::ostream& os) const
+{
+    os << "Triangles: " << GetNumberOfTriangles() << "\tBVH nodes: " << nodes_.size() << '\n';
+}
+
+// ------------------------------------------------------------------------- //
+std::pair<double, double> Mesh::DistanceToBorder(const Vector3D& position, const Vector3D& direction) const
+{
+    auto origin = Vec3(position) - Vec3(position_);
+    auto dir = Vec3(direction);
+    std::array<double, 3> o = { origin.x, origin.y, origin.z };
+    std::array<double, 3> d = { dir.x, dir.y, dir.z };
+
+    // All intersections in direction of the particle trajectory are collected,
+    // since their number decides whether the particle is inside.
+    thread_local std::vector<Hit> hits;
+    hits.clear();
+
+    std::array<unsigned int, 64> stack;
+    size_t n_stack = 0;
+    stack[n_stack++] = 0;
+    while (n_stack > 0) {
+        auto index = stack[--n_stack];
+        auto const& node = nodes_[index];
+
+        // slab test of the bounding box
+        auto t_low = 0.;
+        auto t_up = std::numeric_limits<double>::infinity();
+        for (size_t k = 0; k < 3; ++k) {
+            if (d[k] == 0) {
+                if (o[k] < node.lower[k] || o[k] > node.upper[k])
+                    t_low = std::numeric_limits<double>::infinity();
+                continue;
+            }
+            auto t1 = (node.lower[k] - o[k]) / d[k];
+            auto t2 = (node.upper[k] - o[k]) / d[k];
+            t_low = std::max(t_low, std::min(t1, t2));
+            t_up = std::min(t_up, std::max(t1, t2));
+        }
+        if (t_low > t_up)
+            continue;
+
+        if (node.count == 0) {
+            stack[n_stack++] = node.first;
+            stack[n_stack++] = index + 1;
+            continue;
+        }
+
+        // Moeller-Trumbore test of the triangles of the leaf. The loop has no
+        // branches, so the compiler can vectorize it over the triangles.
+        std::array<double, max_leaf_size> t, det;
+        std::array<bool, max_leaf_size> valid;
+        for (unsigned int j = 0; j < node.count; ++j) {
+            auto i = node.first + j;
+            auto e1 = Vec3(e1_[0][i], e1_[1][i], e1_[2][i]);
+            auto e2 = Vec3(e2_[0][i], e2_[1][i], e2_[2][i]);
+            auto tvec = Vec3(o[0] - v0_[0][i], o[1] - v0_[1][i], o[2] - v0_[2][i]);
+            auto pvec = vector_product(dir, e2);
+            auto qvec = vector_product(tvec, e1);
+            det[j] = e1 * pvec;
+            auto inv_det = 1. / det[j];
+            auto u = (tvec * pvec) * inv_det;
+            auto v = (dir * qvec) * inv_det;
+            t[j] = (e2 * qvec) * inv_det;
+            valid[j] = det[j] != 0 && u >= 0 && v >= 0 && u + v <= 1 && t[j] >= GEOMETRY_PRECISION;
+        }
+        for (unsigned int j = 0; j < node.count; ++j)
+            if (valid[j])
+                hits.push_back({ t[j], det[j] > 0 });
+    }
+
+    // Adjacent triangles, which are both hit on their common edge or vertex,
+    // give the same intersection more than once with the same orientation.
+    std::sort(hits.begin(), hits.end(), [](const Hit& a, const Hit& b) { return a.t < b.t; });
+    size_t n_hits = 0;
+    for (auto const& hit : hits) {
+        if (n_hits > 0 && hits[n_hits - 1].entering == hit.entering
+            && hit.t - hits[n_hits - 1].t < GEOMETRY_PRECISION)
+            continue;
+        hits[n_hits++] = hit;
+    }
+
+    // (-1/-1) mesh is behind the particle or particle is on border but moving
+    // outside
+    // ( dist_1 / -1 ) odd number of intersections, the particle is inside
+    // ( dist_1 / dist_2 ) the mesh is infront of the particle
+    if (n_hits == 0)
+        return { -1, -1 };
+    if (n_hits % 2 == 1)
+        return { hits[0].t, -1 };
+    return { hits[0].t, hits[1].t };
+}
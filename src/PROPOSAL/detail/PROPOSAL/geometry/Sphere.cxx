@@ -3,6 +3,7 @@
 #include "PROPOSAL/Constants.h"
 #include "PROPOSAL/Logging.h"
 #include "PROPOSAL/geometry/Sphere.h"
+#include "PROPOSAL/math/Vec3.h"
 #include <nlohmann/json.hpp>
 
 using namespace PROPOSAL;
@@ -61,6 +62,24 @@ void Sphere::print(std::ostream& os) const
 
 // ------------------------------------------------------------------------- //
 std::pair<double, double> Sphere::DistanceToBorder(const Vector3D& position, const Vector3D& direction) const
+{
+    auto difference = Vec3(position) - Vec3(position_);
+    return distance_to_border(difference * difference, difference * Vec3(direction));
+}
+
+// ------------------------------------------------------------------------- //
+std::array<std::pair<double, double>, 2> Sphere::DistancesToBorder(const Vector3D& position, const Vector3D& direction) const
+{
+    // The opposite direction only changes the sign of B
+    auto difference = Vec3(position) - Vec3(position_);
+    auto difference_length_squared = difference * difference;
+    auto B = difference * Vec3(direction);
+
+    return { distance_to_border(difference_length_squared, B), distance_to_border(difference_length_squared, -B) };
+}
+
+// ------------------------------------------------------------------------- //
+std::pair<double, double> Sphere::distance_to_border(double difference_length_squared, double B) const
 {
     // Calculate intersection of particle trajectory and the sphere
     // sphere (x1 + x0)^2 + (x2 + y0)^2 + (x3 + z0)^2 = radius^2
@@ -72,16 +91,13 @@ std::pair<double, double> Sphere::DistanceToBorder(const Vector3D& position, con
     // ( we want to find the intersection in direction of the particle
     // trajectory)
 
-    double A, B, t1, t2, difference_length_squared;
+    double A, t1, t2;
 
     std::pair<double, double> distance;
 
     double determinant;
 
-    difference_length_squared = std::pow((position - position_).magnitude(), 2);
-    A                         = difference_length_squared - radius_ * radius_;
-
-    B = (position - position_) * direction;
+    A = difference_length_squared - radius_ * radius_;
 
     determinant = B * B - A;
 
@@ -1,5 +1,4 @@
 #include "PROPOSAL/math/Cartesian3D.h"
-#include "PROPOSAL/math/Spherical3D.h"
 #include <nlohmann/json.hpp>
 #include <cmath>
 
@@ -106,31 +105,9 @@ namespace PROPOSAL {
 }
 
 void Cartesian3D::deflect(double cosphi_deflect, double theta_deflect) {
-    if(cosphi_deflect != 1 || theta_deflect != 0)
-    {
-        auto sinphi_deflect = std::sqrt( std::max(0., (1. - cosphi_deflect) * (1. + cosphi_deflect) ));
-        auto tx = sinphi_deflect * std::cos(theta_deflect);
-        auto ty = sinphi_deflect * std::sin(theta_deflect);
-        auto tz = std::sqrt(std::max(1. - tx * tx - ty * ty, 0.));
-        if(cosphi_deflect < 0. ){
-            // Backward deflection
-            tz = -tz;
-        }
-
-        auto spherical = Spherical3D(*this);
-        auto sinth = std::sin(spherical.GetZenith());
-        auto costh = std::cos(spherical.GetZenith());
-        auto sinph = std::sin(spherical.GetAzimuth());
-        auto cosph = std::cos(spherical.GetAzimuth());
-
-        auto rotate_vector_x = Cartesian3D(costh * cosph, costh * sinph, -sinth);
-        auto rotate_vector_y = Cartesian3D(-sinph, cosph, 0.);
-
-        // Rotation towards all tree axes
-        for (size_t i = 0; i < 3; i++) {
-            coordinates[i] = tz * coordinates[i] + tx * rotate_vector_x[i] + ty * rotate_vector_y[i];
-        }
-    }
+    auto vec = Vec3(coordinates);
+    vec.deflect(cosphi_deflect, theta_deflect);
+    coordinates = vec.GetCartesianCoordinates();
 }
 
 std::array<double, 3> Cartesian3D::GetCartesianCoordinates() const {
@@ -0,0 +1,77 @@
+#include "PROPOSAL/math/GaussLegendre.h"
+#include "PROPOSAL/Constants.h"
+#include "PROPOSAL/Logging.h"
+#include "PROPOSAL/math/Integral.h"
+#include <stdexcept>
+
+using namespace PROPOSAL;
+
+GaussLegendre::GaussLegendre(unsigned int order)
+    : nodes(order)
+    , weights(order)
+{
+    if (order == 0)
+        throw std::invalid_argument("Order of Gauss-Legendre quadrature must "
+                                    "be at least one.");
+
+    // Roots of the Legendre polynomial P_n by Newton iteration, starting from
+    // the asymptotic approximation. The roots are symmetric around zero.
+    for (unsigned int i = 0; i < (order + 1) / 2; ++i) {
+        auto z = std::cos(PI * (i + 0.75) / (order + 0.5));
+        auto dp = 0.;
+        for (int iter = 0; iter < 100; ++iter) {
+            auto p0 = 1.;
+            auto p1 = 0.;
+            for (unsigned int j = 1; j <= order; ++j) {
+                auto p2 = p1;
+                p1 = p0;
+                p0 = ((2. * j - 1.) * z * p1 - (j - 1.) * p2) / j;
+            }
+            dp = order * (z * p0 - p1) / (z * z - 1.);
+            auto dz = p0 / dp;
+            z -= dz;
+            if (std::abs(dz) < 1e-15)
+                break;
+        }
+        nodes[i] = -z;
+        nodes[order - 1 - i] = z;
+        weights[i] = 2. / ((1. - z * z) * dp * dp);
+        weights[order - 1 - i] = weights[i];
+    }
+}
+
+InnerIntegration::InnerIntegration()
+    : backend(IntegrationSettings::INNER_INTEGRATION)
+    , tolerance(IntegrationSettings::VERIFICATION_TOLERANCE)
+    , rule(backend == IntegrationSettings::ADAPTIVE
+              ? nullptr
+              : std::make_shared<const GaussLegendre>(
+                  IntegrationSettings::GAUSS_LEGENDRE_ORDER))
+{
+}
+
+double InnerIntegration::Integrate(Integral& integral, double min, double max,
+    const std::function<double(double)>& integrand, int method) const
+{
+    if (!rule || (method != 1 && method != 2 && method != 4))
+        return integral.Integrate(min, max, integrand, method);
+
+    // same degenerate limits as Integral::Integrate
+    if (min == max || (method == 4 && (min <= 0. || max <= 0.)))
+        return 0.;
+
+    auto fixed = method == 4 ? rule->IntegrateWithLog(min, max, integrand)
+                             : rule->Integrate(min, max, integrand);
+    if (backend == IntegrationSettings::GAUSS_LEGENDRE)
+        return fixed;
+
+    auto adaptive = integral.Integrate(min, max, integrand, method);
+    auto deviation = std::abs(fixed - adaptive);
+    if (deviation > tolerance * std::abs(adaptive)) {
+        Logging::Get("proposal.integral")
+            ->warn("Gauss-Legendre integration of order {} on [{}, {}] "
+                   "deviates from the adaptive result: {} vs. {}",
+                rule->GetOrder(), min, max, fixed, adaptive);
+    }
+    return adaptive;
+}
@@ -33,7 +33,7 @@ using namespace PROPOSAL;
 
 double Integral::Integrate(double min,
                            double max,
-                           std::function<double(double)> integrand,
+                           const std::function<double(double)>& integrand,
                            int method,
                            double powerOfSubstitution)
 {
@@ -73,7 +73,7 @@ double Integral::Integrate(double min,
 
 double Integral::IntegrateWithRandomRatio(double min,
                                           double max,
-                                          std::function<double(double)> integrand,
+                                          const std::function<double(double)>& integrand,
                                           int method,
                                           double randomRatio,
                                           double powerOfSubstitution)
@@ -145,7 +145,7 @@ double Integral::GetUpperLimit()
 
 double Integral::IntegrateWithSubstitution(double min,
                                            double max,
-                                           std::function<double(double)> integrand,
+                                           const std::function<double(double)>& integrand,
                                            double powerOfSubstitution,
                                            double randomRatio)
 {
@@ -248,7 +248,7 @@ double Integral::IntegrateWithSubstitution(double min,
 //----------------------------------------------------------------------------//
 //----------------------------------------------------------------------------//
 
-double Integral::IntegrateWithLog(double min, double max, std::function<double(double)> integrand, double randomRatio)
+double Integral::IntegrateWithLog(double min, double max, const std::function<double(double)>& integrand, double randomRatio)
 {
     double aux, result;
 
@@ -340,7 +340,6 @@ Integral::Integral()
     , q_rlist2_()
     , q_iord_()
 {
-    int aux;
     if (romberg_ <= 0)
     {
         Logging::Get("proposal.integral")->warn("Warning (in Integral/Integral/0): romberg = {} must be > 0, setting to 1", romberg_);
@@ -359,14 +358,6 @@ Integral::Integral()
         precision_ = 1.e-6;
     }
 
-    iX_.resize(maxSteps_upper_limit_);
-    iY_.resize(maxSteps_upper_limit_);
-
-    aux = std::max(romberg_, romberg4refine_);
-    c_.resize(aux);
-    d_.resize(aux);
-
-    q_last_3_results_.resize(3);
 }
 
 //----------------------------------------------------------------------------//
@@ -423,13 +414,18 @@ Integral::Integral(int romberg, int maxSteps, double precision)
     , q_rlist2_()
     , q_iord_()
 {
-    int aux;
     if (romberg <= 0)
     {
         Logging::Get("proposal.integral")->warn("Warning (in Integral/Integral/0): romberg = {} must be > 0, setting to 1", romberg);
         romberg = 1;
     }
 
+    if (romberg > max_romberg_order)
+    {
+        romberg = max_romberg_order;
+        Logging::Get("proposal.integral")->warn("Warning (in Integral/Integral/0): romberg exceeds the workspace of the integrator, setting to {}", romberg);
+    }
+
     if (maxSteps <= 0)
     {
         Logging::Get("proposal.integral")->warn("Warning (in Integral/Integral/1): maxSteps = {} must be > 0, setting to 1", maxSteps);
@@ -446,14 +442,6 @@ Integral::Integral(int romberg, int maxSteps, double precision)
     this->maxSteps_upper_limit_ = maxSteps;
     this->precision_            = precision;
 
-    iX_.resize(maxSteps_upper_limit_);
-    iY_.resize(maxSteps_upper_limit_);
-
-    aux = std::max(romberg_, romberg4refine_);
-    c_.resize(aux);
-    d_.resize(aux);
-
-    q_last_3_results_.resize(3);
 }
 
 //----------------------------------------------------------------------------//
@@ -478,35 +466,14 @@ Integral& Integral::operator=(const Integral& integral)
 bool Integral::operator==(const Integral& integral) const
 {
     // if(integrand_ != integral.integrand_)     return false;
-    if (iX_.size() != integral.iX_.size())
+    if (iX_ != integral.iX_)
         return false;
-    if (iY_.size() != integral.iY_.size())
+    if (iY_ != integral.iY_)
         return false;
-    if (c_.size() != integral.c_.size())
+    if (c_ != integral.c_)
         return false;
-    if (d_.size() != integral.d_.size())
+    if (d_ != integral.d_)
         return false;
-
-    for (unsigned int i = 0; i < iX_.size(); i++)
-    {
-        if (iX_.at(i) != integral.iX_.at(i))
-            return false;
-    }
-    for (unsigned int i = 0; i < iY_.size(); i++)
-    {
-        if (iY_.at(i) != integral.iY_.at(i))
-            return false;
-    }
-    for (unsigned int i = 0; i < c_.size(); i++)
-    {
-        if (c_.at(i) != integral.c_.at(i))
-            return false;
-    }
-    for (unsigned int i = 0; i < d_.size(); i++)
-    {
-        if (d_.at(i) != integral.d_.at(i))
-            return false;
-    }
     if (maxSteps_upper_limit_ != integral.maxSteps_upper_limit_)
         return false;
     if (maxSteps_romberg_ != integral.maxSteps_romberg_)
@@ -1063,7 +1030,7 @@ double Integral::RombergIntegrateOpened(double bigValue)
 //----------------------------------------------------------------------------//
 //----------------------------------------------------------------------------//
 
-double Integral::InitIntegralOpenedAndClosed(double min, double max, std::function<double(double)> integrand)
+double Integral::InitIntegralOpenedAndClosed(double min, double max, const std::function<double(double)>& integrand)
 {
     double aux;
 
@@ -1091,7 +1058,7 @@ double Integral::InitIntegralOpenedAndClosed(double min, double max, std::functi
 //----------------------------------------------------------------------------//
 //----------------------------------------------------------------------------//
 
-double Integral::IntegrateClosed(double min, double max, std::function<double(double)> integrand)
+double Integral::IntegrateClosed(double min, double max, const std::function<double(double)>& integrand)
 {
     double aux;
     aux = InitIntegralOpenedAndClosed(min, max, integrand);
@@ -1106,7 +1073,7 @@ double Integral::IntegrateClosed(double min, double max, std::function<double(do
 //----------------------------------------------------------------------------------------------------//
 //----------------------------------------------------------------------------//
 
-double Integral::IntegrateOpened(double min, double max, std::function<double(double)> integrand)
+double Integral::IntegrateOpened(double min, double max, const std::function<double(double)>& integrand)
 {
     double aux;
     aux = InitIntegralOpenedAndClosed(min, max, integrand);
@@ -1124,7 +1091,7 @@ double Integral::IntegrateOpened(double min, double max, std::function<double(do
 
 double Integral::InitIntegralWithSubstitution(double min,
                                               double max,
-                                              std::function<double(double)> integrand,
+                                              const std::function<double(double)>& integrand,
                                               double powerOfSubstitution)
 {
     double aux;
@@ -1190,7 +1157,7 @@ double Integral::InitIntegralWithSubstitution(double min,
 
 double Integral::IntegrateWithSubstitution(double min,
                                            double max,
-                                           std::function<double(double)> integrand,
+                                           const std::function<double(double)>& integrand,
                                            double powerOfSubstitution)
 {
     double aux;
@@ -1329,7 +1296,7 @@ void Integral::RefineUpperLimit(double result)
 //----------------------------------------------------------------------------//
 //----------------------------------------------------------------------------//
 
-double Integral::InitIntegralWithLog(double min, double max, std::function<double(double)> integrand)
+double Integral::InitIntegralWithLog(double min, double max, const std::function<double(double)>& integrand)
 {
     double aux;
 
@@ -1359,7 +1326,7 @@ double Integral::InitIntegralWithLog(double min, double max, std::function<doubl
 //----------------------------------------------------------------------------//
 //----------------------------------------------------------------------------//
 
-double Integral::IntegrateWithLog(double min, double max, std::function<double(double)> integrand)
+double Integral::IntegrateWithLog(double min, double max, const std::function<double(double)>& integrand)
 {
     double aux;
 
@@ -1378,7 +1345,7 @@ double Integral::IntegrateWithLog(double min, double max, std::function<double(d
 
 double Integral::InitIntegralWithLogSubstitution(double min,
                                                  double max,
-                                                 std::function<double(double)> integrand,
+                                                 const std::function<double(double)>& integrand,
                                                  double powerOfSubstitution)
 {
     double aux;
@@ -1447,7 +1414,7 @@ double Integral::InitIntegralWithLogSubstitution(double min,
 
 double Integral::IntegrateWithLogSubstitution(double min,
                                               double max,
-                                              std::function<double(double)> integrand,
+                                              const std::function<double(double)>& integrand,
                                               double powerOfSubstitution)
 {
 
@@ -1485,6 +1452,12 @@ Integral::QuadpackResults Integral::qags(double q_limit, double q_epsabs, double
         return output;
     }
 
+    if (q_limit > max_qags_intervals)
+    {
+        q_limit = max_qags_intervals;
+        Logging::Get("proposal.integral")->warn("the limit exceeds the workspace of qags, setting to {}", q_limit);
+    }
+
     if (q_epsabs < 0. && q_epsrel < 0.)
     {
         output.ier = 6;
@@ -1515,20 +1488,10 @@ Integral::QuadpackResults Integral::qags(double q_limit, double q_epsabs, double
         output.neval = 42 * last - 21;
         return output;
     }
-    std::vector<double> q_alist_;
-    std::vector<double> q_blist_;
-    std::vector<double> q_elist_;
-    std::vector<double> q_rlist_;
-
-    // the maximum number of elements the epsilon table can contain.
-    // if this number is reached, the upper diagonal of the epsilon table is deleted.
-    const int q_limit_epsilon_table_ = 50;
-    q_rlist2_.resize(q_limit_epsilon_table_ + 2);
-    q_alist_.resize(q_limit);
-    q_blist_.resize(q_limit);
-    q_elist_.resize(q_limit);
-    q_rlist_.resize(q_limit);
-    q_iord_.resize(q_limit);
+    std::array<double, max_qags_intervals> q_alist_;
+    std::array<double, max_qags_intervals> q_blist_;
+    std::array<double, max_qags_intervals> q_elist_;
+    std::array<double, max_qags_intervals> q_rlist_;
 
     int ierro   = 0;
     q_alist_[0] = min_;
@@ -1931,7 +1894,7 @@ std::pair<Integral::InterpolationResults, Integral::InterpolationResults> Integr
     return std::make_pair(qk21_output, qk21_abs_output);
 }
 
-int Integral::q_sort(int q_limit, int last, int maxerr, int nrmax, const std::vector<double>& q_elist)
+int Integral::q_sort(int q_limit, int last, int maxerr, int nrmax, const std::array<double, max_qags_intervals>& q_elist)
 {
     // Check whether the list contains more than two error estimates.
     if (last <= 2)
@@ -2189,7 +2152,7 @@ Integral::InterpolationResults Integral::q_epsilon_extrapolation(int q_limit_eps
 //----------------------------------------------------------------------------//
 //----------------------------------------------------------------------------//
 
-void Integral::SetIntegrand(std::function<double(double)> integrand)
+void Integral::SetIntegrand(const std::function<double(double)>& integrand)
 {
     integrand_ = integrand;
 }
@@ -2206,6 +2169,11 @@ void Integral::SetMaxStepsUpperLimit(int maxSteps)
 
 void Integral::SetMaxStepsRomberg(int maxSteps)
 {
+    if (maxSteps > max_romberg_steps)
+    {
+        maxSteps = max_romberg_steps;
+        Logging::Get("proposal.integral")->warn("Warning (in Integral/SetMaxStepsRomberg): maxSteps exceeds the workspace of the integrator, setting to {}", maxSteps);
+    }
     maxSteps_romberg_ = maxSteps;
 }
 
@@ -2251,11 +2219,21 @@ void Integral::SetReverseX(double reverseX)
 
 void Integral::SetRomberg(int romberg)
 {
+    if (romberg > max_romberg_order)
+    {
+        romberg = max_romberg_order;
+        Logging::Get("proposal.integral")->warn("Warning (in Integral/SetRomberg): romberg exceeds the workspace of the integrator, setting to {}", romberg);
+    }
     romberg_ = romberg;
 }
 
 void Integral::SetRomberg4refine(int romberg4refine)
 {
+    if (romberg4refine > max_romberg_order)
+    {
+        romberg4refine = max_romberg_order;
+        Logging::Get("proposal.integral")->warn("Warning (in Integral/SetRomberg4refine): romberg4refine exceeds the workspace of the integrator, setting to {}", romberg4refine);
+    }
     romberg4refine_ = romberg4refine;
 }
 
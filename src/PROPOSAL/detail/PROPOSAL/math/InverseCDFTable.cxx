@@ -0,0 +1,137 @@
+#include "PROPOSAL/math/InverseCDFTable.h"
+#include "PROPOSAL/Constants.h"
+#include <algorithm>
+#include <cmath>
+#include <mutex>
+#include <stdexcept>
+#include <unordered_map>
+
+using namespace PROPOSAL;
+
+namespace {
+double node(unsigned int n, unsigned int nodes, bool dense_ends)
+{
+    auto u = static_cast<double>(n) / (nodes - 1);
+    return dense_ends ? 0.5 * (1. - std::cos(PI * u)) : u;
+}
+} // namespace
+
+InverseCDFTable::InverseCDFTable(const Definition& def)
+    : nodes_e(def.nodes_e)
+    , nodes_x(def.nodes_x)
+    , nodes_quantile(def.nodes_quantile)
+    , dense_ends(def.dense_ends)
+    , quantiles(def.nodes_e * def.nodes_x * def.nodes_quantile, 0.)
+{
+    if (nodes_e < 2 || nodes_x < 2 || def.nodes_y < 2 || nodes_quantile < 2)
+        throw std::invalid_argument("InverseCDFTable needs at least two nodes "
+                                    "per dimension.");
+
+    auto y = std::vector<double>(def.nodes_y);
+    for (size_t m = 0; m < y.size(); ++m)
+        y[m] = static_cast<double>(m) / (y.size() - 1);
+
+    auto cdf = std::vector<double>(def.nodes_y);
+    auto valid = std::vector<bool>(nodes_x);
+    for (unsigned int i = 0; i < nodes_e; ++i) {
+        auto e = static_cast<double>(i) / (nodes_e - 1);
+        for (unsigned int j = 0; j < nodes_x; ++j) {
+            auto x = node(j, nodes_x, dense_ends);
+
+            cdf[0] = 0.;
+            auto f_low = std::max(def.pdf(e, x, y[0]), 0.);
+            for (size_t m = 1; m < y.size(); ++m) {
+                auto f_up = std::max(def.pdf(e, x, y[m]), 0.);
+                cdf[m] = cdf[m - 1] + 0.5 * (f_low + f_up) * (y[m] - y[m - 1]);
+                f_low = f_up;
+            }
+            auto norm = cdf.back();
+            valid[j] = norm > 0.;
+            if (!valid[j])
+                continue;
+
+            auto* q = &quantiles[(i * nodes_x + j) * nodes_quantile];
+            size_t m = 1;
+            for (unsigned int k = 0; k < nodes_quantile; ++k) {
+                auto target = norm * node(k, nodes_quantile, dense_ends);
+                // the lowest quantile is the lower end of the support, which
+                // is not necessarily y = 0
+                while (m < y.size() - 1 && (cdf[m] < target || cdf[m] <= 0.))
+                    ++m;
+                auto width = cdf[m] - cdf[m - 1];
+                auto frac = width > 0. ? (target - cdf[m - 1]) / width : 0.;
+                q[k] = y[m - 1] + std::min(std::max(frac, 0.), 1.)
+                        * (y[m] - y[m - 1]);
+            }
+        }
+        FillEmptyNodes(i, valid);
+    }
+}
+
+void InverseCDFTable::FillEmptyNodes(
+    unsigned int i, const std::vector<bool>& valid)
+{
+    // Nodes on a kinematic limit often have a vanishing density. They would
+    // pull the interpolation of the neighbouring cells towards zero, so they
+    // take over the quantiles of the closest node with a density.
+    auto row = &quantiles[i * nodes_x * nodes_quantile];
+    for (unsigned int j = 0; j < nodes_x; ++j) {
+        if (valid[j])
+            continue;
+        for (unsigned int d = 1; d < nodes_x; ++d) {
+            auto src = j >= d && valid[j - d] ? j - d
+                : j + d < nodes_x && valid[j + d] ? j + d
+                : nodes_x;
+            if (src == nodes_x)
+                continue;
+            std::copy_n(row + src * nodes_quantile, nodes_quantile,
+                row + j * nodes_quantile);
+            break;
+        }
+    }
+}
+
+namespace {
+void locate(double u, unsigned int nodes, unsigned int& idx, double& frac,
+    bool dense_ends = false)
+{
+    u = u > 0. ? std::min(u, 1.) : 0.;
+    if (dense_ends)
+        u = std::acos(1. - 2. * u) / PI;
+    u *= nodes - 1;
+    idx = std::min(static_cast<unsigned int>(u), nodes - 2);
+    frac = u - idx;
+}
+} // namespace
+
+double InverseCDFTable::Evaluate(double e, double x, double rnd) const
+{
+    unsigned int i, j, k;
+    double fe, fx, fq;
+    locate(e, nodes_e, i, fe);
+    locate(x, nodes_x, j, fx, dense_ends);
+    locate(rnd, nodes_quantile, k, fq, dense_ends);
+
+    auto quantile = [this, k, fq](unsigned int i, unsigned int j) {
+        auto* q = &quantiles[(i * nodes_x + j) * nodes_quantile + k];
+        return q[0] + fq * (q[1] - q[0]);
+    };
+    return (1. - fe) * ((1. - fx) * quantile(i, j) + fx * quantile(i, j + 1))
+        + fe * ((1. - fx) * quantile(i + 1, j) + fx * quantile(i + 1, j + 1));
+}
+
+std::shared_ptr<const InverseCDFTable> PROPOSAL::make_inverse_cdf_table(
+    const InverseCDFTable::Definition& def, size_t hash)
+{
+    static std::mutex mutex;
+    static std::unordered_map<size_t, std::shared_ptr<const InverseCDFTable>>
+        tables;
+
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = tables.find(hash);
+    if (it != tables.end())
+        return it->second;
+    auto table = std::make_shared<const InverseCDFTable>(def);
+    tables.emplace(hash, table);
+    return table;
+}
@@ -4,6 +4,7 @@
 #include <fstream>
 #include <iostream>
 #include "PROPOSAL/math/MathMethods.h"
+#include "PROPOSAL/math/TabulatedCubic.h"
 #include "PROPOSAL/Constants.h"
 #include "PROPOSAL/Logging.h"
 #include "PROPOSAL/methods.h"
@@ -447,6 +448,67 @@ double SampleFromGaussian(double mean, double sigma, double rnd, double min, dou
     return sigma * normalppf(rndtmp)  + mean;
 }
 
+namespace {
+// Percent point function of the standard normal distribution, tabulated
+// equidistantly in p in the central region and in q = sqrt(-2 log(p)) in the
+// tails, where it is almost linear in q. The tails are tabulated down to
+// p = exp(-Q_MAX^2 / 2) = 2.6e-18, smaller p are passed to normalppf.
+class NormalPPFTable {
+    static constexpr double P_LOW = 0.02425;
+    static constexpr double Q_MAX = 9.;
+    TabulatedCubic central;
+    TabulatedCubic tail;
+
+    static TabulatedCubic Tabulate(double low, double up, size_t nodes,
+        const std::function<double(double)>& f)
+    {
+        std::vector<double> x(nodes), y(nodes);
+        for (size_t i = 0; i < nodes; ++i) {
+            x[i] = low + (up - low) * i / (nodes - 1);
+            y[i] = f(x[i]);
+        }
+        return TabulatedCubic(x, y);
+    }
+
+public:
+    NormalPPFTable()
+        : central(Tabulate(P_LOW, 1. - P_LOW, 2048,
+            [](double p) { return normalppf(p); }))
+        , tail(Tabulate(std::sqrt(-2. * std::log(P_LOW)), Q_MAX, 512,
+            [](double q) { return -normalppf(std::exp(-0.5 * q * q)); }))
+    {
+    }
+
+    double operator()(double p) const
+    {
+        if (p < P_LOW) {
+            auto q = std::sqrt(-2. * std::log(p));
+            return q < Q_MAX ? -tail(q) : normalppf(p);
+        }
+        if (p > 1. - P_LOW) {
+            auto q = std::sqrt(-2. * std::log1p(-p));
+            return q < Q_MAX ? tail(q) : normalppf(p);
+        }
+        return central(p);
+    }
+};
+} // namespace
+
+double SampleFromTruncatedGaussian(double mean, double sigma, double rnd,
+    double min, double max)
+{
+    static const NormalPPFTable ppf;
+    constexpr double TRUNCATION_LIMIT = 8.;
+
+    if (sigma == 0)
+        return mean;
+    auto z_min = (min - mean) / sigma;
+    auto z_max = (max - mean) / sigma;
+    auto p_min = z_min > -TRUNCATION_LIMIT ? 0.5 * std::erfc(-z_min / SQRT2) : 0.;
+    auto p_max = z_max < TRUNCATION_LIMIT ? 0.5 * std::erfc(-z_max / SQRT2) : 1.;
+    return sigma * ppf(p_min + (p_max - p_min) * rnd) + mean;
+}
+
 double SampleFromExponential(double p, double lambda) {
     return - log1p(-p) / lambda;
 }
@@ -12,6 +12,7 @@ using namespace PROPOSAL;
 
 std::mt19937 RandomGenerator::rng_;
 std::uniform_real_distribution<double> RandomGenerator::uniform_distribution(0.0, 1.0);
+thread_local std::function<double()> RandomGenerator::thread_random_function;
 
 // ------------------------------------------------------------------------- //
 // Constructor & destructor
@@ -34,6 +35,8 @@ RandomGenerator::~RandomGenerator() {}
 // ------------------------------------------------------------------------- //
 double RandomGenerator::RandomDouble()
 {
+    if (thread_random_function)
+        return thread_random_function();
 #ifdef ICECUBE_PROJECT
     if (i3random_gen_)
     {
@@ -84,6 +87,11 @@ void RandomGenerator::SetDefaultRandomNumberGenerator()
     random_function = &RandomGenerator::DefaultRandomDouble;
 }
 
+void RandomGenerator::SetThreadRandomNumberGenerator(std::function<double()> f)
+{
+    thread_random_function = std::move(f);
+}
+
 // ------------------------------------------------------------------------- //
 double RandomGenerator::DefaultRandomDouble()
 {
@@ -1,3 +1,4 @@
+#include <algorithm>
 #include <fstream>
 #include <iostream>
 #include <iterator>
@@ -14,7 +15,8 @@
 
 using namespace PROPOSAL;
 
-Spline::Spline(std::vector<double> x, std::vector<double> y) : x_(x), y_(y) {
+Spline::Spline(std::vector<double> x, std::vector<double> y)
+    : n_subintervalls_(0), n_coeff_(0), x_(x), y_(y) {
     if (x.size() != y.size())
         Logging::Get("proposal.spline")->error(
             "CalculateSpline: x and y (abscissa and ordinate) must have same "
@@ -24,21 +26,27 @@ Spline::Spline(std::vector<double> x, std::vector<double> y) : x_(x), y_(y) {
 Spline::Spline(std::vector<Polynom> splines, std::vector<double> subintervall)
     : splines_(splines),
       subintervall_(subintervall),
-      n_subintervalls_(subintervall_.size()) {}
+      n_subintervalls_(splines_.size()) {
+    update_coefficients();
+}
 
 Spline::Spline(const Spline& spline)
     : splines_(spline.splines_),
       subintervall_(spline.subintervall_),
-      n_subintervalls_(spline.n_subintervalls_) {}
+      n_subintervalls_(spline.n_subintervalls_),
+      coeff_(spline.coeff_),
+      n_coeff_(spline.n_coeff_) {}
 
-Spline::Spline(std::string path, bool binary) {
+Spline::Spline(std::string path, bool binary)
+    : n_subintervalls_(0), n_coeff_(0) {
     Table_read reader(path, binary);
     reader.jump(2);
 
     reader.read(*this);
 }
 
-Spline::Spline(const nlohmann::json& config) {
+Spline::Spline(const nlohmann::json& config)
+    : n_subintervalls_(0), n_coeff_(0) {
     if(!config.contains("x")) throw std::invalid_argument("Spline: x vector must be defined.");
     if(! config["x"].is_array()) throw std::invalid_argument("Spline: x is not an array.");
     if(!config.contains("y")) throw std::invalid_argument("Spline: y vector must be defined.");
@@ -64,22 +72,56 @@ bool Spline::operator!=(const Spline& spline) const {
     return !(*this == spline);
 }
 
-double Spline::evaluate(double x) {
-    for (unsigned int i = 0; i < n_subintervalls_; ++i) {
-        if (subintervall_[i] <= x && x <= subintervall_[i + 1])
-            return splines_[i].evaluate(x);
+void Spline::update_coefficients() {
+    n_coeff_ = 0;
+    for (auto const& spline : splines_)
+        n_coeff_ = std::max(n_coeff_,
+                            (unsigned int)spline.GetCoefficient().size());
+
+    coeff_.assign(n_coeff_ * splines_.size(), 0.);
+    for (unsigned int i = 0; i < splines_.size(); ++i) {
+        auto coeff = splines_[i].GetCoefficient();
+        std::copy(coeff.begin(), coeff.end(), coeff_.begin() + i * n_coeff_);
     }
+}
+
+unsigned int Spline::find_segment(double x) const {
+    // arguments outside of the domain use the first or last subintervall
+    auto it = std::upper_bound(subintervall_.begin() + 1,
+                               subintervall_.begin() + n_subintervalls_, x);
+    return it - subintervall_.begin() - 1;
+}
+
+double Spline::evaluate_with_hint(double x, unsigned int& segment) const {
+    auto inside = [this, x](unsigned int i) {
+        return i < n_subintervalls_ && subintervall_[i] <= x &&
+               x <= subintervall_[i + 1];
+    };
+    if (!inside(segment)) {
+        if (inside(segment + 1))
+            ++segment;
+        else if (segment > 0 && inside(segment - 1))
+            --segment;
+        else
+            segment = find_segment(x);
+    }
+
+    auto c = coeff_.data() + segment * n_coeff_;
+    double aux = c[n_coeff_ - 1];
+    for (int i = n_coeff_ - 2; i >= 0; --i)
+        aux = aux * x + c[i];
+    return aux;
+}
 
-    // logger warining
-    if (x > subintervall_.back())
-        return splines_[n_subintervalls_ - 1].evaluate(x);
-    else
-        return splines_[0].evaluate(x);
+double Spline::evaluate(double x) const {
+    auto segment = find_segment(x);
+    return evaluate_with_hint(x, segment);
 }
 
 void Spline::Derivative() {
-    for (auto spline : splines_)
+    for (auto& spline : splines_)
         spline = spline.GetDerivative();
+    update_coefficients();
 }
 
 void Spline::Antiderivative(double c) {
@@ -91,6 +133,7 @@ void Spline::Antiderivative(double c) {
         aux1 += splines_[i].evaluate(subintervall_[i + 1]) -
                 splines_[i].evaluate(subintervall_[i]);
     }
+    update_coefficients();
 }
 
 std::pair<double, double> Spline::GetDomain() {
@@ -146,6 +189,7 @@ std::istream& operator>>(std::istream& is, Spline& s) {
         container.coeff.clear();
     }
     s.subintervall_.push_back(container.domain.second);
+    s.update_coefficients();
     return is;
 }
 
@@ -208,6 +252,7 @@ void Linear_Spline::calculate_splines(std::vector<double> x,
 
     n_subintervalls_ = n;
     subintervall_ = x;
+    update_coefficients();
 }
 
 //----------------------------------------------------------------------------//
@@ -292,4 +337,5 @@ void Cubic_Spline::calculate_splines(std::vector<double> x,
     }
     subintervall_.push_back(x.back());
     n_subintervalls_ = n;
+    update_coefficients();
 }
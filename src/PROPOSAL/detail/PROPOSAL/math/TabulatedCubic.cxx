@@ -0,0 +1,143 @@
+#include "PROPOSAL/math/TabulatedCubic.h"
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <stdexcept>
+#include <utility>
+
+using namespace PROPOSAL;
+
+namespace {
+// index i of the segment [x_i, x_i+1] containing value, clamped to the
+// first and last segment
+size_t find_segment(const std::vector<double>& x, double value)
+{
+    auto it = std::upper_bound(x.begin() + 1, x.end() - 1, value);
+    return static_cast<size_t>(it - x.begin()) - 1;
+}
+
+// first of the (up to) four points used for the segment i
+size_t first_point(size_t i, size_t n_points)
+{
+    return n_points < 4 ? 0 : std::min(std::max(i, size_t(1)) - 1, n_points - 4);
+}
+} // namespace
+
+TabulatedCubic::TabulatedCubic(
+    std::vector<double> x_, const std::vector<double>& y)
+    : x(std::move(x_))
+{
+    if (x.size() != y.size())
+        throw std::invalid_argument("TabulatedCubic: x and y must have the "
+                                    "same dimension.");
+    if (x.size() < 2)
+        throw std::invalid_argument("TabulatedCubic: at least two points "
+                                    "are required.");
+    if (!std::is_sorted(x.begin(), x.end()))
+        throw std::invalid_argument("TabulatedCubic: x must be sorted.");
+
+    auto step = (x.back() - x.front()) / (x.size() - 1);
+    inverse_step = step > 0 ? 1. / step : 0.;
+    for (size_t i = 1; i < x.size() && inverse_step > 0; ++i)
+        if (std::abs(x[i] - (x.front() + i * step)) > 1e-10 * step)
+            inverse_step = 0.;
+
+    auto n = std::min(x.size(), size_t(4));
+    coeff.reserve(4 * (x.size() - 1));
+    for (size_t i = 0; i + 1 < x.size(); ++i) {
+        auto first = first_point(i, x.size());
+
+        // Newton form of the interpolating polynomial in t = x - x_i ...
+        std::array<double, 4> t, f;
+        for (size_t k = 0; k < n; ++k) {
+            t[k] = x[first + k] - x[i];
+            f[k] = y[first + k];
+        }
+        for (size_t k = 1; k < n; ++k)
+            for (size_t j = n - 1; j >= k; --j)
+                f[j] = (f[j] - f[j - 1]) / (t[j] - t[j - k]);
+
+        // ... expanded in powers of t by Horner's scheme
+        std::array<double, 4> c = { f[n - 1], 0., 0., 0. };
+        for (size_t k = n - 1; k-- > 0;) {
+            for (size_t j = n - 1; j > 0; --j)
+                c[j] = c[j - 1] - t[k] * c[j];
+            c[0] = f[k] - t[k] * c[0];
+        }
+        coeff.insert(coeff.end(), c.begin(), c.end());
+    }
+}
+
+size_t TabulatedCubic::FindSegment(double value) const
+{
+    if (inverse_step == 0.)
+        return ::find_segment(x, value);
+    auto position = (value - x.front()) * inverse_step;
+    if (!(position > 0.))
+        return 0;
+    return std::min(static_cast<size_t>(position), x.size() - 2);
+}
+
+double TabulatedCubic::operator()(double value) const
+{
+    return (*this)(value, FindSegment(value));
+}
+
+double TabulatedCubic::operator()(double value, size_t i) const
+{
+    auto t = value - x[i];
+    auto c = &coeff[4 * i];
+    return c[0] + t * (c[1] + t * (c[2] + t * c[3]));
+}
+
+TabulatedCubic2D::TabulatedCubic2D(std::vector<double> x1_,
+    const std::vector<std::vector<double>>& x2,
+    const std::vector<std::vector<double>>& y)
+    : x1(std::move(x1_))
+{
+    if (x1.size() != x2.size() || x1.size() != y.size())
+        throw std::invalid_argument("TabulatedCubic2D: x1, x2 and y must "
+                                    "have the same number of rows.");
+    if (x1.size() < 4)
+        throw std::invalid_argument("TabulatedCubic2D: at least four rows "
+                                    "are required.");
+    if (!std::is_sorted(x1.begin(), x1.end()))
+        throw std::invalid_argument("TabulatedCubic2D: x1 must be sorted.");
+
+    rows.reserve(x1.size());
+    for (size_t i = 0; i < x1.size(); ++i)
+        rows.emplace_back(x2[i], y[i]);
+}
+
+double TabulatedCubic2D::operator()(double value1, double value2) const
+{
+    auto first = first_point(find_segment(x1, value1), x1.size());
+
+    // Lagrange form of the cubic through the rows first, ..., first + 3
+    double weight[4];
+    for (size_t j = 0; j < 4; ++j) {
+        weight[j] = 1.;
+        for (size_t k = 0; k < 4; ++k)
+            if (k != j)
+                weight[j] *= (value1 - x1[first + k])
+                    / (x1[first + j] - x1[first + k]);
+    }
+
+    // range of x2 at value1
+    auto low = 0.;
+    auto up = 0.;
+    for (size_t j = 0; j < 4; ++j) {
+        low += weight[j] * rows[first + j].GetLowerLimit();
+        up += weight[j] * rows[first + j].GetUpperLimit();
+    }
+    auto relative = up > low ? (value2 - low) / (up - low) : 0.;
+
+    auto result = 0.;
+    for (size_t j = 0; j < 4; ++j) {
+        auto const& row = rows[first + j];
+        auto row_low = row.GetLowerLimit();
+        result += weight[j]
+            * row(row_low + relative * (row.GetUpperLimit() - row_low));
+    }
+    return result;
+}
@@ -1,6 +1,10 @@
 #include "PROPOSAL/propagation_utility/ContRand.h"
 #include "PROPOSAL/crosssection/CrossSection.h"
 #include "PROPOSAL/propagation_utility/Displacement.h"
+#include "PROPOSAL/propagation_utility/PropagationUtilityIntegral.h"
+#include "PROPOSAL/math/TabulatedCubic.h"
+#include "PROPOSAL/Constants.h"
+#include <cmath>
 
 using namespace PROPOSAL;
 
@@ -34,6 +38,53 @@ double ContRand::FunctionToIntegral(double energy)
     return disp->FunctionToIntegral(energy) * sum;
 }
 
+void ContRand::BuildVarianceTables()
+{
+    auto variance_integral = UtilityIntegral(
+        [this](double E) { return FunctionToIntegral(E); },
+        disp->GetLowerLim(), hash);
+
+    auto log_lower = std::log(disp->GetLowerLim());
+    auto log_upper = std::log(InterpolationSettings::UPPER_ENERGY_LIM);
+    auto nodes = size_t{ 1000 };
+    std::vector<double> log_energies(nodes), energies(nodes);
+    for (size_t i = 0; i < nodes; ++i) {
+        log_energies[i] = log_lower + (log_upper - log_lower) * i / (nodes - 1);
+        energies[i] = std::exp(log_energies[i]);
+    }
+    energies.front() = disp->GetLowerLim();
+    energies.back() = InterpolationSettings::UPPER_ENERGY_LIM;
+
+    std::vector<double> variance(nodes), f(nodes);
+    for (size_t i = 0; i < nodes; ++i) {
+        if (i > 0)
+            variance[i] = variance[i - 1]
+                + variance_integral.Calculate(energies[i], energies[i - 1]);
+        f[i] = -FunctionToIntegral(energies[i]);
+    }
+    cumulative_variance
+        = std::make_shared<const TabulatedCubic>(log_energies, variance);
+    variance_integrand = std::make_shared<const TabulatedCubic>(log_energies, f);
+}
+
+bool ContRand::InVarianceTables(double initial_energy) const noexcept
+{
+    return cumulative_variance
+        && initial_energy <= InterpolationSettings::UPPER_ENERGY_LIM;
+}
+
+double ContRand::TabulatedVariance(
+    double initial_energy, double final_energy) const
+{
+    if (initial_energy - final_energy < initial_energy * IPREC)
+        return (*variance_integrand)(
+                   std::log(0.5 * (initial_energy + final_energy)))
+            * (initial_energy - final_energy);
+    return std::max((*cumulative_variance)(std::log(initial_energy))
+            - (*cumulative_variance)(std::log(final_energy)),
+        0.);
+}
+
 void ContRand::CalculateHash() noexcept {
     hash_combine(hash, disp->GetHash());
 }
\ No newline at end of file
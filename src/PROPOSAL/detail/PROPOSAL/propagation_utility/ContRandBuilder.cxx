@@ -11,6 +11,7 @@ template <> void ContRandBuilder<UtilityInterpolant>::build_tables()
 {
     cont_rand_integral.BuildTables("cont_rand_",
                                    InterpolationSettings::NODES_UTILITY, false);
+    BuildVarianceTables();
 }
 } // namespace PROPOSAL
 
@@ -4,6 +4,16 @@
 
 using namespace PROPOSAL;
 
+void Decay::EnergyDecay(const std::vector<double>& energy,
+    const std::vector<double>& rnd, const std::vector<double>& density,
+    std::vector<double>& decay_energy)
+{
+    assert(energy.size() == rnd.size() && energy.size() == density.size());
+    decay_energy.resize(energy.size());
+    for (size_t i = 0; i < energy.size(); ++i)
+        decay_energy[i] = EnergyDecay(energy[i], rnd[i], density[i]);
+}
+
 double Decay::FunctionToIntegral(double energy) {
     assert(!std::isinf(lifetime));
     assert(energy >= mass);
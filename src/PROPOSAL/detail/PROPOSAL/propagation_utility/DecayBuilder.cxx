@@ -1,6 +1,7 @@
 #include "PROPOSAL/propagation_utility/DecayBuilder.h"
 #include "PROPOSAL/propagation_utility/PropagationUtilityInterpolant.h"
 #include "PROPOSAL/Constants.h"
+#include <cassert>
 
 using namespace PROPOSAL;
 
@@ -34,6 +35,17 @@ double DecayBuilder::EnergyDecay(double energy, double rnd, double density)
     return decay_integral->GetUpperLimit(energy, rndd * lifetime);
 }
 
+void DecayBuilder::EnergyDecay(const std::vector<double>& energy,
+    const std::vector<double>& rnd, const std::vector<double>& density,
+    std::vector<double>& decay_energy)
+{
+    assert(energy.size() == rnd.size() && energy.size() == density.size());
+    decay_energy.resize(energy.size());
+    for (size_t i = 0; i < energy.size(); ++i)
+        decay_energy[i]
+            = DecayBuilder::EnergyDecay(energy[i], rnd[i], density[i]);
+}
+
 namespace PROPOSAL {
 std::unique_ptr<Decay> make_decay(
     std::shared_ptr<Displacement> disp, const ParticleDef& p, bool interpol)
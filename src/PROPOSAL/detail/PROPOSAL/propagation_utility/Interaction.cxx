@@ -2,6 +2,7 @@
 #include "PROPOSAL/crosssection/CrossSection.h"
 #include "PROPOSAL/propagation_utility/Displacement.h"
 
+#include <cassert>
 #include <sstream>
 #include <numeric>
 
@@ -17,6 +18,15 @@ Interaction::Interaction(
         throw std::invalid_argument("At least one crosssection is required.");
 }
 
+void Interaction::EnergyInteraction(const std::vector<double>& energy,
+    const std::vector<double>& rnd, std::vector<double>& interaction_energy)
+{
+    assert(energy.size() == rnd.size());
+    interaction_energy.resize(energy.size());
+    for (size_t i = 0; i < energy.size(); ++i)
+        interaction_energy[i] = EnergyInteraction(energy[i], rnd[i]);
+}
+
 double Interaction::FunctionToIntegral(double energy) const
 {
     auto total_rate = calculate_total_rate(energy);
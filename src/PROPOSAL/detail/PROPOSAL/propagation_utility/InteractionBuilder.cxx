@@ -4,6 +4,7 @@
 #include "PROPOSAL/crosssection/CrossSectionDNDX/AxisBuilderDNDX.h"
 #include "PROPOSAL/crosssection/CrossSection.h"
 #include "PROPOSAL/Constants.h"
+#include <cassert>
 
 using namespace PROPOSAL;
 
@@ -73,6 +74,16 @@ double InteractionBuilder::EnergyInteraction(double energy, double rnd)
     return interaction_integral->GetUpperLimit(energy, rndi);
 }
 
+void InteractionBuilder::EnergyInteraction(const std::vector<double>& energy,
+    const std::vector<double>& rnd, std::vector<double>& interaction_energy)
+{
+    assert(energy.size() == rnd.size());
+    interaction_energy.resize(energy.size());
+    for (size_t i = 0; i < energy.size(); ++i)
+        interaction_energy[i] = InteractionBuilder::EnergyInteraction(
+            energy[i], rnd[i]);
+}
+
 double InteractionBuilder::EnergyIntegral(double E_i, double E_f) {
     return interaction_integral->Calculate(E_i, E_f);
 }
@@ -113,6 +113,24 @@ double PropagationUtility::EnergyInteraction(
     return collection.interaction_calc->EnergyInteraction(energy, rnd());
 }
 
+void PropagationUtility::EnergyDecay(const std::vector<double>& energy,
+    const std::vector<double>& rnd, const std::vector<double>& density,
+    std::vector<double>& decay_energy)
+{
+    if (collection.decay_calc) {
+        collection.decay_calc->EnergyDecay(energy, rnd, density, decay_energy);
+        return;
+    }
+    decay_energy.assign(energy.size(), 0.); // no decay, e.g. particle is stable
+}
+
+void PropagationUtility::EnergyInteraction(const std::vector<double>& energy,
+    const std::vector<double>& rnd, std::vector<double>& interaction_energy)
+{
+    collection.interaction_calc->EnergyInteraction(
+        energy, rnd, interaction_energy);
+}
+
 double PropagationUtility::EnergyRandomize(
     double initial_energy, double final_energy, std::function<double()> rnd,
     double min_energy = 0)
@@ -138,6 +156,23 @@ double PropagationUtility::TimeElapsed(
         initial_energy, final_energy, distance, density);
 }
 
+std::pair<double, double> PropagationUtility::LengthAndTimeContinuous(
+    double initial_energy, double final_energy, double density)
+{
+    return collection.time_calc->GrammageAndTimeElapsed(
+        *collection.displacement_calc, initial_energy, final_energy, density);
+}
+
+void PropagationUtility::LengthAndTimeContinuous(
+    const std::vector<double>& initial_energy,
+    const std::vector<double>& final_energy,
+    const std::vector<double>& density, std::vector<double>& grammage,
+    std::vector<double>& time)
+{
+    collection.time_calc->GrammageAndTimeElapsed(*collection.displacement_calc,
+        initial_energy, final_energy, density, grammage, time);
+}
+
 std::tuple<Cartesian3D, Cartesian3D> PropagationUtility::DirectionsScatter(
     double displacement, double initial_energy, double final_energy,
     const Vector3D& direction, std::function<double()> rnd)
@@ -162,12 +197,14 @@ Cartesian3D PropagationUtility::DirectionDeflect(InteractionType type,
     std::function<double()> rnd, size_t component) const
 {
     if (collection.scattering) {
-        auto v_rnd = std::vector<double>(
-            collection.scattering->StochasticDeflectionRandomNumbers(type));
-        for (auto& r : v_rnd)
-            r = rnd();
+        auto n_rnd = collection.scattering->StochasticDeflectionRandomNumbers(type);
+        if (n_rnd == 0)
+            return direction; // no deflection for this interaction type
+        auto random_numbers = stochastic_deflection::RandomNumbers();
+        for (size_t i = 0; i < n_rnd; ++i)
+            random_numbers[i] = rnd();
         auto angles = collection.scattering->CalculateStochasticDeflection(
-            type, initial_energy, final_energy, v_rnd, component);
+            type, initial_energy, final_energy, random_numbers, component);
         auto direction_new = Cartesian3D(direction);
         direction_new.deflect(std::cos(angles.zenith), angles.azimuth);
         return direction_new;
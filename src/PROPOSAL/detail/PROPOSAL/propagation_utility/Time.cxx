@@ -2,9 +2,34 @@
 #include "PROPOSAL/Constants.h"
 #include "PROPOSAL/propagation_utility/Displacement.h"
 #include "PROPOSAL/methods.h"
+#include <cassert>
+#include <tuple>
 
 using namespace PROPOSAL;
 
 Time::Time(double _mass)
         : mass(_mass) {}
 
+
+std::pair<double, double> Time::GrammageAndTimeElapsed(Displacement& disp,
+    double initial_energy, double final_energy, double local_density)
+{
+    auto grammage = disp.SolveTrackIntegral(initial_energy, final_energy);
+    return std::make_pair(grammage,
+        TimeElapsed(initial_energy, final_energy, grammage, local_density));
+}
+
+void Time::GrammageAndTimeElapsed(Displacement& disp,
+    const std::vector<double>& initial_energy,
+    const std::vector<double>& final_energy,
+    const std::vector<double>& local_density, std::vector<double>& grammage,
+    std::vector<double>& time)
+{
+    assert(initial_energy.size() == final_energy.size()
+        && initial_energy.size() == local_density.size());
+    grammage.resize(initial_energy.size());
+    time.resize(initial_energy.size());
+    for (size_t i = 0; i < initial_energy.size(); ++i)
+        std::tie(grammage[i], time[i]) = GrammageAndTimeElapsed(
+            disp, initial_energy[i], final_energy[i], local_density[i]);
+}
@@ -1,5 +1,6 @@
 #include "PROPOSAL/propagation_utility/TimeBuilder.h"
 #include "PROPOSAL/Constants.h"
+#include "PROPOSAL/math/TabulatedCubic.h"
 #include "PROPOSAL/propagation_utility/PropagationUtilityInterpolant.h"
 
 using namespace PROPOSAL;
@@ -26,6 +27,56 @@ ExactTimeBuilder::ExactTimeBuilder(
 {
     time_integral->BuildTables("time_", InterpolationSettings::NODES_UTILITY,
                                false);
+    BuildTables();
+}
+
+void ExactTimeBuilder::BuildTables()
+{
+    // Both integrals are accumulated segment by segment from the lower
+    // energy limit, so every node is integrated only once and short steps at
+    // low energies do not suffer from the cancellation of large values.
+    auto grammage_integral = UtilityIntegral(
+        [this](double E) { return disp->FunctionToIntegral(E); },
+        disp->GetLowerLim(), hash);
+    auto exact_time_integral = UtilityIntegral(
+        [this](double E) { return FunctionToIntegral(E); },
+        disp->GetLowerLim(), hash);
+
+    auto log_lower = std::log(disp->GetLowerLim());
+    auto log_upper = std::log(InterpolationSettings::UPPER_ENERGY_LIM);
+    auto nodes = size_t{ 1000 };
+    std::vector<double> log_energies(nodes), energies(nodes);
+    for (size_t i = 0; i < nodes; ++i) {
+        log_energies[i] = log_lower + (log_upper - log_lower) * i / (nodes - 1);
+        energies[i] = std::exp(log_energies[i]);
+    }
+    energies.front() = disp->GetLowerLim();
+    energies.back() = InterpolationSettings::UPPER_ENERGY_LIM;
+
+    std::vector<double> grammage(nodes), time(nodes), f_grammage(nodes),
+        f_time(nodes);
+    for (size_t i = 0; i < nodes; ++i) {
+        if (i > 0) {
+            grammage[i] = grammage[i - 1]
+                + grammage_integral.Calculate(energies[i], energies[i - 1]);
+            time[i] = time[i - 1]
+                + exact_time_integral.Calculate(energies[i], energies[i - 1]);
+        }
+        f_grammage[i] = -disp->FunctionToIntegral(energies[i]);
+        f_time[i] = -FunctionToIntegral(energies[i]);
+    }
+    cumulative_grammage
+        = std::make_shared<const TabulatedCubic>(log_energies, grammage);
+    cumulative_time = std::make_shared<const TabulatedCubic>(log_energies, time);
+    grammage_integrand
+        = std::make_shared<const TabulatedCubic>(log_energies, f_grammage);
+    time_integrand = std::make_shared<const TabulatedCubic>(log_energies, f_time);
+}
+
+bool ExactTimeBuilder::InTables(double initial_energy) const noexcept
+{
+    return cumulative_time
+        && initial_energy <= InterpolationSettings::UPPER_ENERGY_LIM;
 }
 
 double ExactTimeBuilder::TimeElapsed(double initial_energy, double final_energy,
@@ -33,10 +84,47 @@ double ExactTimeBuilder::TimeElapsed(double initial_energy, double final_energy,
 {
     (void)grammage;
     assert(initial_energy >= final_energy);
-    return time_integral->Calculate(initial_energy, final_energy)
+    if (!InTables(initial_energy))
+        return time_integral->Calculate(initial_energy, final_energy)
+            / local_density;
+
+    if (initial_energy - final_energy < initial_energy * IPREC)
+        return (*time_integrand)(std::log(0.5 * (initial_energy + final_energy)))
+            * (initial_energy - final_energy) / local_density;
+    return ((*cumulative_time)(std::log(initial_energy))
+               - (*cumulative_time)(std::log(final_energy)))
         / local_density;
 }
 
+std::pair<double, double> ExactTimeBuilder::GrammageAndTimeElapsed(
+    Displacement& displacement, double initial_energy, double final_energy,
+    double local_density)
+{
+    assert(initial_energy >= final_energy);
+    if (!InTables(initial_energy))
+        return Time::GrammageAndTimeElapsed(
+            displacement, initial_energy, final_energy, local_density);
+
+    // the grammage is tabulated from disp, displacement is not used
+    if (initial_energy - final_energy < initial_energy * IPREC) {
+        auto log_energy = std::log(0.5 * (initial_energy + final_energy));
+        auto segment = grammage_integrand->FindSegment(log_energy);
+        auto delta = initial_energy - final_energy;
+        return std::make_pair(
+            (*grammage_integrand)(log_energy, segment) * delta,
+            (*time_integrand)(log_energy, segment) * delta / local_density);
+    }
+    auto log_initial = std::log(initial_energy);
+    auto log_final = std::log(final_energy);
+    auto segment_initial = cumulative_grammage->FindSegment(log_initial);
+    auto segment_final = cumulative_grammage->FindSegment(log_final);
+    auto grammage = (*cumulative_grammage)(log_initial, segment_initial)
+        - (*cumulative_grammage)(log_final, segment_final);
+    auto time = (*cumulative_time)(log_initial, segment_initial)
+        - (*cumulative_time)(log_final, segment_final);
+    return std::make_pair(grammage, time / local_density);
+}
+
 double ExactTimeBuilder::FunctionToIntegral(double energy)
 {
     auto square_momentum = std::max((energy - mass) * (energy + mass), 0.);
@@ -8,6 +8,7 @@
  */
 
 #include <array>
+#include <cassert>
 #include <cmath>
 // #include <algorithm>
 // #include <stdlib.h>
@@ -64,25 +65,55 @@ double Highland::CalculateTheta0(double grammage, double ei, double ef)
     return y;
 }
 
+void Highland::CalculateTheta0(const std::vector<double>& grammage,
+    const std::vector<double>& ei, const std::vector<double>& ef,
+    std::vector<double>& theta0)
+{
+    assert(grammage.size() == ei.size() && grammage.size() == ef.size());
+    theta0.resize(grammage.size());
+    for (size_t i = 0; i < grammage.size(); ++i)
+        theta0[i] = CalculateTheta0(grammage[i], ei[i], ef[i]);
+}
+
 //----------------------------------------------------------------------------//
 
-ScatteringOffset Highland::CalculateRandomAngle(
-    double grammage, double ei, double ef, const std::array<double, 4>& rnd)
+namespace {
+ScatteringOffset SampleOffset(double theta0, const std::array<double, 4>& rnd)
 {
     ScatteringOffset offsets;
-    auto Theta0 = CalculateTheta0(grammage, ei, ef);
 
-    auto rnd1 = Theta0 * normalppf(rnd[0]);
-    auto rnd2 = Theta0 * normalppf(rnd[1]);
+    auto rnd1 = theta0 * PROPOSAL::normalppf(rnd[0]);
+    auto rnd2 = theta0 * PROPOSAL::normalppf(rnd[1]);
 
-    offsets.sx = 0.5 * (rnd1 / SQRT3 + rnd2);
+    offsets.sx = 0.5 * (rnd1 / PROPOSAL::SQRT3 + rnd2);
     offsets.tx = rnd2;
 
-    rnd1 = Theta0 * normalppf(rnd[2]);
-    rnd2 = Theta0 * normalppf(rnd[3]);
+    rnd1 = theta0 * PROPOSAL::normalppf(rnd[2]);
+    rnd2 = theta0 * PROPOSAL::normalppf(rnd[3]);
 
-    offsets.sy = 0.5 * (rnd1 / SQRT3 + rnd2);
+    offsets.sy = 0.5 * (rnd1 / PROPOSAL::SQRT3 + rnd2);
     offsets.ty = rnd2;
 
     return offsets;
 }
+} // namespace
+
+ScatteringOffset Highland::CalculateRandomAngle(
+    double grammage, double ei, double ef, const std::array<double, 4>& rnd)
+{
+    return SampleOffset(CalculateTheta0(grammage, ei, ef), rnd);
+}
+
+std::vector<ScatteringOffset> Highland::CalculateRandomAngle(
+    const std::vector<double>& grammage, const std::vector<double>& ei,
+    const std::vector<double>& ef, const std::vector<std::array<double, 4>>& rnd)
+{
+    assert(rnd.size() == grammage.size());
+    std::vector<double> theta0;
+    CalculateTheta0(grammage, ei, ef, theta0);
+
+    std::vector<ScatteringOffset> offsets(theta0.size());
+    for (size_t i = 0; i < theta0.size(); ++i)
+        offsets[i] = SampleOffset(theta0[i], rnd[i]);
+    return offsets;
+}
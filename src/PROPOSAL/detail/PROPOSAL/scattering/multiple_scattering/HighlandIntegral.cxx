@@ -1,22 +1,52 @@
 #include "PROPOSAL/scattering/multiple_scattering/HighlandIntegral.h"
 #include "PROPOSAL/propagation_utility/PropagationUtilityInterpolant.h"
 #include "PROPOSAL/math/InterpolantBuilder.h"
+#include "PROPOSAL/math/TabulatedCubic.h"
 #include "PROPOSAL/propagation_utility/DisplacementBuilder.h"
 
 using namespace PROPOSAL;
 using namespace multiple_scattering;
 
-double HighlandIntegral::CalculateTheta0(double grammage, double ei, double ef) {
-    auto integral_result = highland_integral->Calculate(ei, ef);
-    assert(integral_result >= 0);
+double HighlandIntegral::CalculateIntegral(double ei, double ef)
+{
+    if (!cumulative_integral || ei > InterpolationSettings::UPPER_ENERGY_LIM)
+        return highland_integral->Calculate(ei, ef);
+
+    if (ei - ef < ei * IPREC)
+        return (*integrand)(std::log(0.5 * (ei + ef))) * (ei - ef);
+    return (*cumulative_integral)(std::log(ef))
+        - (*cumulative_integral)(std::log(ei));
+}
+
+double HighlandIntegral::Theta0FromIntegral(
+    double grammage, double integral) const
+{
     auto aux = 13.6
-               * std::sqrt(std::max(integral_result, 0.) / radiation_length)
+               * std::sqrt(std::max(integral, 0.) / radiation_length)
                * std::abs(charge);
     aux *= std::max(
             1. + 0.038 * std::log(grammage / radiation_length), 0.0);
     return std::min(aux, 1.0);
 }
 
+double HighlandIntegral::CalculateTheta0(double grammage, double ei, double ef) {
+    auto integral_result = CalculateIntegral(ei, ef);
+    assert(integral_result >= 0);
+    return Theta0FromIntegral(grammage, integral_result);
+}
+
+void HighlandIntegral::CalculateTheta0(const std::vector<double>& grammage,
+    const std::vector<double>& ei, const std::vector<double>& ef,
+    std::vector<double>& theta0)
+{
+    assert(grammage.size() == ei.size() && grammage.size() == ef.size());
+    theta0.resize(grammage.size());
+    for (size_t i = 0; i < grammage.size(); ++i)
+        theta0[i] = CalculateIntegral(ei[i], ef[i]);
+    for (size_t i = 0; i < grammage.size(); ++i)
+        theta0[i] = Theta0FromIntegral(grammage[i], theta0[i]);
+}
+
 double HighlandIntegral::Integral(Displacement& disp, double energy)
 {
     auto square_momentum = (energy - mass) * (energy + mass);
@@ -38,6 +68,26 @@ HighlandIntegral::HighlandIntegral(const ParticleDef& p, Medium const& m,
                 [this, disp](double E) { return Integral(*disp, E); },
                 disp->GetLowerLim(), disp->GetHash())) {
         highland_integral->BuildTables("scattering_", 500, true);
+
+        // The integral from the upper energy limit is read from the
+        // interpolant once and tabulated equidistantly in log(E), so the
+        // integral of a step is the difference of two direct table lookups.
+        auto log_lower = std::log(disp->GetLowerLim());
+        auto log_upper = std::log(InterpolationSettings::UPPER_ENERGY_LIM);
+        auto nodes = size_t{ 1000 };
+        std::vector<double> log_energies(nodes), cumulative(nodes), f(nodes);
+        for (size_t i = 0; i < nodes; ++i) {
+            log_energies[i] = log_lower
+                + (log_upper - log_lower) * i / (nodes - 1);
+            auto energy = std::min(std::exp(log_energies[i]),
+                InterpolationSettings::UPPER_ENERGY_LIM);
+            cumulative[i] = highland_integral->Calculate(
+                InterpolationSettings::UPPER_ENERGY_LIM, energy);
+            f[i] = -Integral(*disp, energy);
+        }
+        cumulative_integral = std::make_shared<const TabulatedCubic>(
+                log_energies, cumulative);
+        integrand = std::make_shared<const TabulatedCubic>(log_energies, f);
 };
 
 namespace PROPOSAL {
@@ -4,12 +4,26 @@
 #include "PROPOSAL/Constants.h"
 #include "PROPOSAL/math/MathMethods.h"
 #include "PROPOSAL/medium/Medium.h"
+#include "PROPOSAL/methods.h"
 #include "PROPOSAL/particle/ParticleDef.h"
 #include "PROPOSAL/scattering/multiple_scattering/Coefficients.h"
 #include "PROPOSAL/scattering/multiple_scattering/Moliere.h"
 
 using namespace PROPOSAL::multiple_scattering;
 
+namespace {
+// range of B covered by the angle table, below B_lower no deviation is
+// assumed
+constexpr double B_lower = 4.5;
+constexpr double B_upper = 40.;
+
+// Angles in the single scattering tail, which contains 0.5% of the
+// distribution, are still calculated by Newton's method. Below, the table
+// deviates by less than 0.3% from it.
+constexpr unsigned int nodes_quantile = 1000;
+constexpr double quantile_limit = 0.995;
+} // namespace
+
 ScatteringOffset Moliere::CalculateRandomAngle(
     double grammage, double ei, double ef, const std::array<double, 4>& rnd)
 {
@@ -59,7 +73,7 @@ ScatteringOffset Moliere::CalculateRandomAngle(
 
         //  Check for inappropriate values of B. If B < 4.5 it is practical to
         //  assume no deviation.
-        if ((xn < 4.5) || xn != xn) {
+        if ((xn < B_lower) || xn != xn) {
             return offsets;
         }
 
@@ -68,14 +82,14 @@ ScatteringOffset Moliere::CalculateRandomAngle(
 
     double pre_factor = std::sqrt(chiCSq_ * B_[max_weight_index_]);
 
-    auto rnd1 = GetRandom(pre_factor, rnd[0]);
-    auto rnd2 = GetRandom(pre_factor, rnd[1]);
+    auto rnd1 = GetRandom(pre_factor, beta_Sq, rnd[0]);
+    auto rnd2 = GetRandom(pre_factor, beta_Sq, rnd[1]);
 
     offsets.sx = 0.5 * (rnd1 / SQRT3 + rnd2);
     offsets.tx = rnd2;
 
-    rnd1 = GetRandom(pre_factor, rnd[2]);
-    rnd2 = GetRandom(pre_factor, rnd[3]);
+    rnd1 = GetRandom(pre_factor, beta_Sq, rnd[2]);
+    rnd2 = GetRandom(pre_factor, beta_Sq, rnd[3]);
 
     offsets.sy = 0.5 * (rnd1 / SQRT3 + rnd2);
     offsets.ty = rnd2;
@@ -89,7 +103,8 @@ ScatteringOffset Moliere::CalculateRandomAngle(
 //----------------------------------------------------------------------------//
 //----------------------------------------------------------------------------//
 
-Moliere::Moliere(const ParticleDef& particle_def, Medium const& medium)
+Moliere::Moliere(
+    const ParticleDef& particle_def, Medium const& medium, bool interpolate)
     : Parametrization(particle_def.mass)
     , numComp_(medium.GetNumComponents())
     , ZSq_A_average_(0.0)
@@ -144,6 +159,69 @@ Moliere::Moliere(const ParticleDef& particle_def, Medium const& medium)
         if (weight[i + 1] > weight[i])
             max_weight_index_ = i + 1;
     }
+
+    if (!interpolate)
+        return;
+
+    // The distribution of theta / sqrt(chi_c^2 B) only depends on the B of
+    // all components, which follow from the B of the component with maximum
+    // weight and beta^2. The reduced angle is u = y / sqrt(1 - y), so the
+    // unit interval covers the whole distribution and the single scattering
+    // tail ~ u^-3 becomes a constant density in y.
+    auto def = InverseCDFTable::Definition();
+    def.pdf = [this](double e, double beta_Sq, double y) {
+        if (y >= 1.)
+            return 0.;
+        auto B_max = 1. / (1. / B_lower - e * (1. / B_lower - 1. / B_upper));
+        auto B = CalculateB(B_max, beta_Sq);
+        auto u = y / std::sqrt(1. - y);
+
+        double pdf = 0;
+        for (int i = 0; i < numComp_; i++) {
+            double x = u * u * B_max / B[i];
+
+            pdf += weight_ZZ_[i] * std::sqrt(B_max / (B[i] * PI))
+                * (std::exp(-x) + f1M(x) / B[i] + f2M(x) / (B[i] * B[i]));
+        }
+        return pdf * (1. - 0.5 * y) / std::pow(1. - y, 1.5);
+    };
+    def.nodes_e = 40;
+    def.nodes_x = numComp_ > 1 ? 10 : 2;
+    def.nodes_y = 1000;
+    def.nodes_quantile = nodes_quantile;
+
+    auto hash = size_t{ 0 };
+    for (int i = 0; i < numComp_; i++)
+        hash_combine(hash, Zi_[i], weight_ZZ_[i]);
+    hash_combine(hash, max_weight_index_, B_lower, B_upper, def.nodes_e,
+        def.nodes_x, def.nodes_y, def.nodes_quantile, std::string("moliere"));
+    angle_table_ = make_inverse_cdf_table(def, hash);
+}
+
+//----------------------------------------------------------------------------//
+
+std::vector<double> Moliere::CalculateB(double B_max, double beta_Sq) const
+{
+    // B - ln(B) = ln(chi_c^2/chi_a^2) + 1 - 2*EULER_MASCHERONI, where chi_a^2
+    // of the components differ by Z^(2/3) (1.13 + 3.76 (alpha Z)^2 / beta^2)
+    auto screening = [this, beta_Sq](int i) {
+        return std::pow(Zi_[i], 2. / 3.)
+            * (1.13 * beta_Sq + 3.76 * ALPHA * ALPHA * Zi_[i] * Zi_[i]);
+    };
+
+    std::vector<double> B(numComp_);
+    for (int i = 0; i < numComp_; i++) {
+        auto omega = B_max - std::log(B_max)
+            + std::log(screening(max_weight_index_) / screening(i));
+
+        // Newton-Raphson method, there is no solution for omega < 1
+        auto xn = std::max(omega + std::log(std::max(omega, 1.)), 1. + 1e-3);
+        for (int n = 0; n < 10; n++)
+            xn = std::max(xn - (xn - std::log(xn) - omega) / (1. - 1. / xn),
+                1. + 1e-3);
+        B[i] = std::max(xn, B_lower);
+    }
+    return B;
 }
 
 //----------------------------------------------------------------------------//
@@ -171,6 +249,8 @@ bool Moliere::compare(const Parametrization& scattering) const
         return false;
     else if (B_ != sc->B_)
         return false;
+    else if (angle_table_ != sc->angle_table_)
+        return false;
     else
         return true;
 }
@@ -344,8 +424,19 @@ double Moliere::F(double theta)
 //-------------------------generate random angle------------------------------//
 //----------------------------------------------------------------------------//
 
-double Moliere::GetRandom(double pre_factor, double rnd)
+double Moliere::GetRandom(double pre_factor, double beta_Sq, double rnd)
 {
+    // The distribution is symmetric, so the absolute value of the angle is
+    // given by the quantile |2 rnd - 1| of the distribution of |theta|.
+    auto quantile = std::abs(2. * rnd - 1.);
+    auto B_max = B_[max_weight_index_];
+    if (angle_table_ && B_max <= B_upper && quantile < quantile_limit) {
+        auto e = (1. / B_lower - 1. / B_max) / (1. / B_lower - 1. / B_upper);
+        auto y = angle_table_->Evaluate(e, beta_Sq, quantile);
+        auto theta = pre_factor * y / std::sqrt(1. - y);
+        return (rnd < 0.5) ? -theta : theta;
+    }
+
     //  Generate random angles following Moliere's distribution by comparing a
     //  uniformly distributed random number with the integral of the
     //  distribution. Therefore, determine the angle where the integral is equal
@@ -12,13 +12,12 @@
 #include <string>
 #include <sstream>
 #include <iostream>
-#include <PROPOSAL/math/Spherical3D.h>
 
 
 #include "PROPOSAL/methods.h"
 #include "PROPOSAL/scattering/multiple_scattering/Parametrization.h"
 #include "PROPOSAL/math/Cartesian3D.h"
-#include "PROPOSAL/math/Spherical3D.h"
+#include "PROPOSAL/math/Vec3.h"
 
 using namespace PROPOSAL::multiple_scattering;
 
@@ -45,27 +44,20 @@ namespace PROPOSAL {
             auto sz = std::sqrt(std::max(1. - (sx * sx + sy * sy), 0.));
             auto tz = std::sqrt(std::max(1. - (tx * tx + ty * ty), 0.));
 
-            auto direction_spherical = Spherical3D(direction);
-            auto sinth = std::sin(direction_spherical.GetZenith());
-            auto costh = std::cos(direction_spherical.GetZenith());
-            auto sinph = std::sin(direction_spherical.GetAzimuth());
-            auto cosph = std::cos(direction_spherical.GetAzimuth());
-
-            auto rotate_vector_x = Cartesian3D(costh * cosph, costh * sinph, -sinth);
-            auto rotate_vector_y = Cartesian3D(-sinph, cosph, 0.);
+            // rotation axes perpendicular to the direction
+            auto direction_cartesian = Vec3(direction);
+            auto basis = direction_cartesian.GetOrthonormalBasis();
 
             // Rotation towards all tree axes
-            auto direction_cartesian = Cartesian3D(direction);
-            auto mean_direction = sz * direction_cartesian;
-            mean_direction += sx * rotate_vector_x;
-            mean_direction += sy * rotate_vector_y;
+            auto mean_direction = sz * direction_cartesian + sx * basis.first
+                + sy * basis.second;
 
             // Rotation towards all tree axes
-            auto final_direction = tz * direction_cartesian;
-            final_direction += tx * rotate_vector_x;
-            final_direction += ty * rotate_vector_y;
+            auto final_direction = tz * direction_cartesian
+                + tx * basis.first + ty * basis.second;
 
-            return std::make_pair(mean_direction, final_direction);
+            return std::make_pair(Cartesian3D(mean_direction),
+                Cartesian3D(final_direction));
         }
     }
 }
@@ -0,0 +1,125 @@
+#include "PROPOSAL/scattering/stochastic_deflection/RmsThetaTable.h"
+#include <cmath>
+#include <limits>
+#include <mutex>
+#include <stdexcept>
+#include <unordered_map>
+
+using namespace PROPOSAL;
+
+namespace {
+// grid in log(e_i) and log(nu / (1 - nu)), the nu range covers
+// 3e-7 < nu < 1 - 3e-7
+constexpr double STEP = 0.1;
+constexpr double LOGIT_NU_MAX = 15.;
+constexpr unsigned int NODES_HALF = 151; // nodes of nu <= 0.5 and nu >= 0.5
+constexpr unsigned int NODES_NU = 2 * NODES_HALF;
+// maximal relative deviation from the parametrization in the center of a cell
+constexpr double TOLERANCE = 1e-2;
+
+double logit_nu(unsigned int j)
+{
+    // both halves have a node at 0.5
+    return -LOGIT_NU_MAX + (j < NODES_HALF ? j : j - 1) * STEP;
+}
+
+double evaluate(const stochastic_deflection::RmsThetaTable::rms_theta_t& rms_theta,
+    double e_i, double nu)
+{
+    auto rms = std::numeric_limits<double>::quiet_NaN();
+    try {
+        rms = rms_theta(e_i, nu);
+    } catch (const std::invalid_argument&) {
+        // parametrization not defined at this point
+    }
+    if (rms > 0. && std::isfinite(rms))
+        return rms;
+    return std::numeric_limits<double>::quiet_NaN();
+}
+} // namespace
+
+stochastic_deflection::RmsThetaTable::RmsThetaTable(
+    const rms_theta_t& rms_theta, double e_min, double e_max)
+    : log_e_min(std::log(e_min))
+    , nodes_e(static_cast<unsigned int>(
+                  std::ceil((std::log(e_max) - log_e_min) / STEP))
+          + 1)
+{
+    if (!(e_min > 0.) || !(e_max > e_min))
+        throw std::invalid_argument("RmsThetaTable: energy range is empty.");
+
+    // The parametrizations may change at nu = 0.5, so both halves have their
+    // own node there, which is evaluated from the respective side.
+    auto nu_nodes = std::vector<double>(NODES_NU);
+    for (unsigned int j = 0; j < NODES_NU; ++j)
+        nu_nodes[j] = 1. / (1. + std::exp(-logit_nu(j)));
+    nu_nodes[NODES_HALF - 1] = 0.5;
+    nu_nodes[NODES_HALF] = std::nextafter(0.5, 1.);
+
+    log_rms_theta.resize(nodes_e * NODES_NU);
+    for (unsigned int i = 0; i < nodes_e; ++i) {
+        auto e_i = std::exp(log_e_min + i * STEP);
+        for (unsigned int j = 0; j < NODES_NU; ++j)
+            log_rms_theta[i * NODES_NU + j]
+                = std::log(evaluate(rms_theta, e_i, nu_nodes[j]));
+    }
+
+    // Cells with a discontinuity of the parametrization, e.g. a change of
+    // the rms formula, are not interpolated.
+    direct_cells.resize(nodes_e * NODES_NU, false);
+    for (unsigned int i = 0; i + 1 < nodes_e; ++i) {
+        auto e_i = std::exp(log_e_min + (i + 0.5) * STEP);
+        for (unsigned int j = 0; j + 1 < NODES_NU; ++j) {
+            auto node = log_rms_theta.data() + i * NODES_NU + j;
+            auto center = std::exp(0.25
+                * (node[0] + node[1] + node[NODES_NU] + node[NODES_NU + 1]));
+            auto nu = 1. / (1. + std::exp(-0.5 * (logit_nu(j) + logit_nu(j + 1))));
+            auto rms = evaluate(rms_theta, e_i, nu);
+            if (!(std::abs(center / rms - 1.) < TOLERANCE))
+                direct_cells[i * NODES_NU + j] = true;
+        }
+    }
+}
+
+double stochastic_deflection::RmsThetaTable::operator()(
+    double e_i, double nu) const noexcept
+{
+    auto x = (std::log(e_i) - log_e_min) / STEP;
+    auto y = (std::log(nu / (1. - nu)) + LOGIT_NU_MAX) / STEP;
+    // negated comparisons to catch NaN as well
+    if (!(x >= 0. && x < nodes_e - 1 && y >= 0. && y < NODES_NU - 2))
+        return std::numeric_limits<double>::quiet_NaN();
+    if (nu > 0.5)
+        y += 1.; // skip the last node of the lower half
+
+    auto i = static_cast<unsigned int>(x);
+    auto j = static_cast<unsigned int>(y);
+    if (direct_cells[i * NODES_NU + j])
+        return std::numeric_limits<double>::quiet_NaN();
+    auto dx = x - i;
+    auto dy = y - j;
+    auto node = log_rms_theta.data() + i * NODES_NU + j;
+
+    // invalid nodes are NaN and propagate into the result
+    auto low = node[0] + dy * (node[1] - node[0]);
+    auto up = node[NODES_NU] + dy * (node[NODES_NU + 1] - node[NODES_NU]);
+    return std::exp(low + dx * (up - low));
+}
+
+std::shared_ptr<const stochastic_deflection::RmsThetaTable>
+stochastic_deflection::make_rms_theta_table(
+    const RmsThetaTable::rms_theta_t& rms_theta, double e_min, double e_max,
+    size_t hash)
+{
+    static std::mutex mutex;
+    static std::unordered_map<size_t, std::shared_ptr<const RmsThetaTable>>
+        tables;
+
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = tables.find(hash);
+    if (it != tables.end())
+        return it->second;
+    auto table = std::make_shared<const RmsThetaTable>(rms_theta, e_min, e_max);
+    tables.emplace(hash, table);
+    return table;
+}
@@ -1,16 +1,36 @@
 #include "PROPOSAL/scattering/stochastic_deflection/bremsstrahlung/BremsGinneken.h"
 #include "PROPOSAL/Constants.h"
 #include "PROPOSAL/medium/Components.h"
+#include "PROPOSAL/medium/Medium.h"
 #include "PROPOSAL/math/MathMethods.h"
 #include "PROPOSAL/Logging.h"
+#include "PROPOSAL/methods.h"
 #include <cmath> 
 #include <stdexcept>
 #include <algorithm>
+#include <limits>
 #include <string>
 
 using namespace PROPOSAL;
 using namespace std;
 
+stochastic_deflection::BremsGinneken::BremsGinneken(
+    const ParticleDef& p_def, const Medium& medium)
+    : mass(p_def.mass)
+{
+    auto e_min = mass / 1000.0;
+    auto e_max = InterpolationSettings::UPPER_ENERGY_LIM / 1000.0;
+    for (auto& comp : medium.GetComponents()) {
+        auto Z = comp.GetNucCharge();
+        auto hash = std::hash<std::string>()("bremsginneken");
+        hash_combine(hash, mass, Z, e_max);
+        auto table = make_rms_theta_table(
+            [this, Z](double e_i, double nu) { return get_rms_theta(e_i, nu, Z); },
+            e_min, e_max, hash);
+        rms_theta_tables.emplace_back(comp.GetHash(), table);
+    }
+}
+
 double stochastic_deflection::BremsGinneken::f_nu_g(double nu, double n, double k_4) const {
     return pow(nu, (1/n + 1)) + pow((0.2/k_4), (1/n)) * nu - pow((0.2/k_4), (1/n));
 }
@@ -27,8 +47,7 @@ double stochastic_deflection::BremsGinneken::get_nu_g(double n, double k_4) cons
     return 0.5; // return boundary value of parametrization
 }
 
-double stochastic_deflection::BremsGinneken::get_rms_theta(double e_i, double e_f, double mass, double Z) const {
-    auto nu = (e_i - e_f) / (e_i - mass); 
+double stochastic_deflection::BremsGinneken::get_rms_theta(double e_i, double nu, double Z) const {
     if (nu <= 0.5) {
         auto k_1 = 0.092 * pow(e_i, -1.0/3.0);
         auto k_2 = 0.052 / e_i * pow(Z, -0.25);
@@ -58,16 +77,26 @@ double stochastic_deflection::BremsGinneken::get_rms_theta(double e_i, double e_
 
 UnitSphericalVector 
 stochastic_deflection::BremsGinneken::CalculateStochasticDeflection(
-    double e_i, double e_f, std::vector<double> const& rnd, size_t component) const
+    double e_i, double e_f, RandomNumbers const& rnd, size_t component) const
 {
     // All energies should be in units of GeV
     e_i = e_i / 1000.0;
     e_f = e_f / 1000.0;
     auto muon_mass = mass / 1000.0;
-    // Use Z of medium
-    auto Z = Component::GetComponentForHash(component).GetNucCharge(); 
 
-    auto rms_theta = get_rms_theta(e_i, e_f, muon_mass, Z);
+    auto nu = (e_i - e_f) / (e_i - muon_mass);
+    auto rms_theta = std::numeric_limits<double>::quiet_NaN();
+    for (auto& table : rms_theta_tables) {
+        if (table.first == component) {
+            rms_theta = (*table.second)(e_i, nu);
+            break;
+        }
+    }
+    if (std::isnan(rms_theta)) {
+        // Use Z of medium
+        auto Z = Component::GetComponentForHash(component).GetNucCharge();
+        rms_theta = get_rms_theta(e_i, nu, Z);
+    }
     
     auto lambda = 1 / (rms_theta * rms_theta);
     // Need sqrt because of sampling in theta^2
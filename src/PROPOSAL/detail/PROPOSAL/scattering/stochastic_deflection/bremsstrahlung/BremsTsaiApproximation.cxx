@@ -5,7 +5,7 @@ using namespace PROPOSAL;
 
 UnitSphericalVector 
 stochastic_deflection::BremsTsaiApproximation::CalculateStochasticDeflection(
-    double e_i, double e_f, std::vector<double> const& rnd, size_t) const
+    double e_i, double e_f, RandomNumbers const& rnd, size_t) const
 {
     auto epsilon = e_i - e_f;
     auto theta_star = 1.0;
@@ -8,7 +8,7 @@ using namespace PROPOSAL;
 
 UnitSphericalVector
 stochastic_deflection::EpairGinneken::CalculateStochasticDeflection(
-        double e_i, double e_f, std::vector<double> const& rnd, size_t) const
+        double e_i, double e_f, RandomNumbers const& rnd, size_t) const
 {
     // All energies should be in units of GeV
     e_i = e_i / 1000.0;
@@ -17,7 +17,6 @@ stochastic_deflection::EpairGinneken::CalculateStochasticDeflection(
     auto muon_mass = mass / 1000.0;
 
     // Muon values
-    auto n = -1.0;
     auto a = 8.9 / 10000.0; 
     auto b = 1.5 / 100000.0;
     auto c = 0.032;
@@ -25,8 +24,10 @@ stochastic_deflection::EpairGinneken::CalculateStochasticDeflection(
     auto e = 0.1;
 
     auto nu = (e_i - e_f) / (e_i - muon_mass);
-    auto min = std::min(a * pow(nu, 0.25) * (1.0 + b * e_i) + c * nu / (nu + d), e);
-    auto rms_theta = (2.3 + log(e_i)) * pow(1.0 - nu, n) / e_i * pow(nu - 2.0 * electron_mass / e_i, 2) / (nu * nu) * min;
+    auto min = std::min(a * std::sqrt(std::sqrt(nu)) * (1.0 + b * e_i) + c * nu / (nu + d), e);
+    // (1 - nu)^n with n = -1, the powers are written out to avoid std::pow
+    auto threshold = (nu - 2.0 * electron_mass / e_i) / nu;
+    auto rms_theta = (2.3 + log(e_i)) / ((1.0 - nu) * e_i) * threshold * threshold * min;
     
     auto lambda = 1 / (rms_theta * rms_theta);
     // Need sqrt because of sampling in theta^2
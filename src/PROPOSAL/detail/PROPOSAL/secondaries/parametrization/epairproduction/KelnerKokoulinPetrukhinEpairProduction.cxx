@@ -1,6 +1,8 @@
 
 #include "PROPOSAL/secondaries/parametrization/epairproduction/KelnerKokoulinPetrukhinEpairProduction.h"
 #include "PROPOSAL/Constants.h"
+#include "PROPOSAL/medium/Components.h"
+#include "PROPOSAL/methods.h"
 #include "PROPOSAL/particle/Particle.h"
 
 #include <cmath>
@@ -13,29 +15,99 @@ using std::sqrt;
 
 using namespace PROPOSAL;
 
-double secondaries::KelnerKokoulinPetrukhinEpairProduction::CalculateRho(
-    double energy, double v, const Component& comp, double rnd1, double rnd2)
+namespace {
+// The rho distribution rises steeply close to rho = 0. It is tabulated and
+// integrated in t with rho / rho_max = (exp(a t) - 1) / (exp(a) - 1), which
+// places most of the nodes close to the rise.
+constexpr double rho_substitution = 15.;
+
+double rho_from_substitution(double t)
 {
+    return std::expm1(rho_substitution * t) / std::expm1(rho_substitution);
+}
 
+double rho_substitution_jacobian(double t)
+{
+    return rho_substitution * std::exp(rho_substitution * t)
+        / std::expm1(rho_substitution);
+}
+} // namespace
+
+secondaries::KelnerKokoulinPetrukhinEpairProduction::
+    KelnerKokoulinPetrukhinEpairProduction(
+        const ParticleDef& p, const Medium& medium, bool interpolate)
+    : param(false)
+    , p_def(p)
+    , lower_energy_lim(param.GetLowerEnergyLim(p))
+{
+    if (!interpolate)
+        return;
+
+    auto log_energy_range
+        = std::log(InterpolationSettings::UPPER_ENERGY_LIM / lower_energy_lim);
+    for (auto const& comp : medium.GetComponents()) {
+        auto def = InverseCDFTable::Definition();
+        def.dense_ends = true;
+        def.pdf = [this, comp, log_energy_range](double e, double x, double y) {
+            auto energy = lower_energy_lim * std::exp(e * log_energy_range);
+            auto lim = param.GetKinematicLimits(p_def, comp, energy);
+            if (lim.v_min >= lim.v_max)
+                return 0.;
+            auto v = lim.v_min * std::pow(lim.v_max / lim.v_min, x);
+            auto rho_max = CalculateRhoMax(energy, v);
+            if (!(rho_max > 0.))
+                return 0.;
+            return rho_substitution_jacobian(y)
+                * param.FunctionToIntegral(
+                    p_def, comp, energy, v, rho_max * rho_from_substitution(y));
+        };
+        auto hash = param.GetHash();
+        hash_combine(hash, comp.GetHash(), p_def.mass, p_def.charge,
+            lower_energy_lim, InterpolationSettings::UPPER_ENERGY_LIM,
+            std::string("epair_rho"));
+        rho_tables[comp.GetHash()] = make_inverse_cdf_table(def, hash);
+    }
+}
+
+double secondaries::KelnerKokoulinPetrukhinEpairProduction::CalculateRhoMax(
+    double energy, double v) const
+{
     auto aux = 1 - (4 * ME) / (energy * v);
     auto aux2 = 1 - (6 * p_def.mass * p_def.mass) / (energy * energy * (1 - v));
+    return std::sqrt(aux) * aux2;
+}
 
-    double rho_max = std::sqrt(aux) * aux2;
+double secondaries::KelnerKokoulinPetrukhinEpairProduction::CalculateRho(
+    double energy, double v, const Component& comp, double rnd1, double rnd2)
+{
+    double rho_max = CalculateRhoMax(energy, v);
 
     if (rho_max < 0) {
         std::stringstream ss;
-        ss << "Rho should never be smaller than zero. Something with aux: "
-           << aux << ", aux2: " << aux2 << " got wrong.";
+        ss << "Rho should never be smaller than zero. Something with energy: "
+           << energy << ", v: " << v << " got wrong.";
         throw std::logic_error(ss.str());
     }
 
-    auto integrand = [&](double rho) {
-        return param.FunctionToIntegral(p_def, comp, energy, v, rho);
-    };
-
     auto rho = 0.;
-    if (integral.IntegrateWithRandomRatio(0, rho_max, integrand, 3, rnd1) > 0)
-        rho = integral.GetUpperLimit();
+    auto table = rho_tables.find(comp.GetHash());
+    if (table != rho_tables.end()) {
+        auto lim = param.GetKinematicLimits(p_def, comp, energy);
+        auto e = std::log(energy / lower_energy_lim)
+            / std::log(InterpolationSettings::UPPER_ENERGY_LIM / lower_energy_lim);
+        auto x = std::log(v / lim.v_min) / std::log(lim.v_max / lim.v_min);
+        rho = rho_max * rho_from_substitution(table->second->Evaluate(e, x, rnd1));
+    } else {
+        // same substitution as the table, the steep rise of the density
+        // close to rho = 0 is not resolved by an integration in rho
+        auto integrand = [&](double t) {
+            return rho_substitution_jacobian(t)
+                * param.FunctionToIntegral(
+                    p_def, comp, energy, v, rho_max * rho_from_substitution(t));
+        };
+        if (integral.IntegrateWithRandomRatio(0, 1, integrand, 3, rnd1) > 0)
+            rho = rho_max * rho_from_substitution(integral.GetUpperLimit());
+    }
 
     if (rnd2 < 0.5)
         rho *= -1.;
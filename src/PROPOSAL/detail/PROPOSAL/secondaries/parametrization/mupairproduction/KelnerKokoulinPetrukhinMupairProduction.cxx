@@ -1,6 +1,8 @@
 
 #include "PROPOSAL/secondaries/parametrization/mupairproduction/KelnerKokoulinPetrukhinMupairProduction.h"
 #include "PROPOSAL/Constants.h"
+#include "PROPOSAL/medium/Components.h"
+#include "PROPOSAL/methods.h"
 #include "PROPOSAL/particle/Particle.h"
 
 #include <cmath>
@@ -16,6 +18,39 @@ using std::sqrt;
 
 using namespace PROPOSAL;
 
+secondaries::KelnerKokoulinPetrukhinMupairProduction::
+    KelnerKokoulinPetrukhinMupairProduction(
+        const ParticleDef& p, const Medium& medium, bool interpolate)
+    : p_def(p)
+    , lower_energy_lim(param.GetLowerEnergyLim(p))
+{
+    if (!interpolate)
+        return;
+
+    auto log_energy_range
+        = std::log(InterpolationSettings::UPPER_ENERGY_LIM / lower_energy_lim);
+    for (auto const& comp : medium.GetComponents()) {
+        auto def = InverseCDFTable::Definition();
+        def.dense_ends = true;
+        def.pdf = [this, comp, log_energy_range](double e, double x, double y) {
+            auto energy = lower_energy_lim * std::exp(e * log_energy_range);
+            auto lim = param.GetKinematicLimits(p_def, comp, energy);
+            if (lim.v_min >= lim.v_max)
+                return 0.;
+            auto v = lim.v_min * std::pow(lim.v_max / lim.v_min, x);
+            auto rho_max = 1 - 2 * MMU / (v * energy);
+            if (!(rho_max > 0.))
+                return 0.;
+            return param.FunctionToIntegral(
+                p_def, comp, energy, v, y * rho_max);
+        };
+        auto hash = param.GetHash();
+        hash_combine(hash, comp.GetHash(), p_def.mass, p_def.charge,
+            lower_energy_lim, InterpolationSettings::UPPER_ENERGY_LIM,
+            std::string("mupair_rho"));
+        rho_tables[comp.GetHash()] = make_inverse_cdf_table(def, hash);
+    }
+}
 
 double secondaries::KelnerKokoulinPetrukhinMupairProduction::CalculateRho(
     double energy, double v, const Component& comp, double rnd1, double rnd2)
@@ -23,12 +58,22 @@ double secondaries::KelnerKokoulinPetrukhinMupairProduction::CalculateRho(
     auto rho_max = 1 - 2 * MMU / (v * energy);
     if (rho_max < 0)
         return 0;
-    integral.IntegrateWithRandomRatio(0, rho_max,
-        [&](double rho) {
-            return param.FunctionToIntegral(p_def, comp, energy, v, rho);
-        },
-        3, rnd1);
-    auto rho_tmp = integral.GetUpperLimit();
+    auto rho_tmp = 0.;
+    auto table = rho_tables.find(comp.GetHash());
+    if (table != rho_tables.end()) {
+        auto lim = param.GetKinematicLimits(p_def, comp, energy);
+        auto e = std::log(energy / lower_energy_lim)
+            / std::log(InterpolationSettings::UPPER_ENERGY_LIM / lower_energy_lim);
+        auto x = std::log(v / lim.v_min) / std::log(lim.v_max / lim.v_min);
+        rho_tmp = rho_max * table->second->Evaluate(e, x, rnd1);
+    } else {
+        integral.IntegrateWithRandomRatio(0, rho_max,
+            [&](double rho) {
+                return param.FunctionToIntegral(p_def, comp, energy, v, rho);
+            },
+            3, rnd1);
+        rho_tmp = integral.GetUpperLimit();
+    }
     if (rnd2 < 0.5) {
         return -rho_tmp;
     } else {
@@ -1,7 +1,47 @@
 #include "PROPOSAL/secondaries/parametrization/photopairproduction/PhotoPairProductionTsai.h"
+#include "PROPOSAL/methods.h"
 
 using namespace PROPOSAL;
 
+namespace {
+// substitution theta = t^subst, which smoothes the forward peak
+double theta_substitution(double energy)
+{
+    return std::max(1., std::log10(energy));
+}
+} // namespace
+
+secondaries::PhotoPairProductionTsai::PhotoPairProductionTsai(
+    ParticleDef p, Medium m, bool interpolate)
+    : PhotoPairProductionTsaiForwardPeaked(p, m)
+    , lower_energy_lim(crosssection::PhotoPairTsai().GetLowerEnergyLim(p))
+{
+    if (!interpolate)
+        return;
+
+    auto log_energy_range
+        = std::log(InterpolationSettings::UPPER_ENERGY_LIM / lower_energy_lim);
+    for (auto const& comp : m.GetComponents()) {
+        auto def = InverseCDFTable::Definition();
+        def.dense_ends = true;
+        def.pdf = [this, comp, log_energy_range](double e, double x, double y) {
+            auto energy = lower_energy_lim * std::exp(e * log_energy_range);
+            auto x_min = ME / energy;
+            if (x_min >= 0.5)
+                return 0.;
+            x = x_min + (1. - 2. * x_min) * x;
+            auto subst = theta_substitution(energy);
+            auto t = y * std::pow(PI, 1. / subst);
+            return subst * std::pow(t, subst - 1.)
+                * FunctionToIntegral(energy, x, std::pow(t, subst), comp);
+        };
+        auto hash = comp.GetHash();
+        hash_combine(hash, lower_energy_lim,
+            InterpolationSettings::UPPER_ENERGY_LIM, std::string("tsai_theta"));
+        theta_tables[comp.GetHash()] = make_inverse_cdf_table(def, hash);
+    }
+}
+
 double secondaries::PhotoPairProductionTsai::FunctionToIntegral(
     double energy, double x, double theta, const Component& comp)
 {
@@ -94,23 +134,38 @@ double secondaries::PhotoPairProductionTsai::FunctionToIntegral(
     return aux;
 }
 
+double secondaries::PhotoPairProductionTsai::SampleSubstitutedTheta(
+    double energy, double x, const Component& comp, double rnd)
+{
+    auto subst = theta_substitution(energy);
+    auto t_max = std::pow(PI, 1. / subst);
+    auto table = theta_tables.find(comp.GetHash());
+    if (table != theta_tables.end()) {
+        auto e = std::log(energy / lower_energy_lim)
+            / std::log(InterpolationSettings::UPPER_ENERGY_LIM / lower_energy_lim);
+        auto x_min = ME / energy;
+        auto x_scaled = x_min < 0.5 ? (x - x_min) / (1. - 2. * x_min) : 0.5;
+        return t_max * table->second->Evaluate(e, x_scaled, rnd);
+    }
+    auto integrand_substitution = [&, energy, x, comp](double t) {
+        return subst * std::pow(t, subst - 1.)
+        * FunctionToIntegral(energy, x, std::pow(t, subst), comp);
+    };
+    integral.IntegrateWithRandomRatio(
+            0., t_max, integrand_substitution, 3, rnd);
+    return integral.GetUpperLimit();
+}
+
 std::tuple<Cartesian3D, Cartesian3D>
 secondaries::PhotoPairProductionTsai::CalculateDirections(
         const Vector3D& dir, double energy, double rho, const Component& comp,
         double rnd1, double rnd2, double rnd3)
 {
-    auto subst = std::max(1., std::log10(energy));
-    auto integrand_substitution = [&, energy, rho, comp](double t) {
-        return subst * std::pow(t, subst - 1.)
-        * FunctionToIntegral(energy, rho, std::pow(t, subst), comp);
-    };
-    auto t_max = std::pow(PI, 1. / subst);
-    integral.IntegrateWithRandomRatio(
-            0., t_max, integrand_substitution, 3, rnd1);
-    auto cosphi0 = std::cos(std::pow(integral.GetUpperLimit(), subst));
-    integral.IntegrateWithRandomRatio(
-            0., t_max, integrand_substitution, 3, rnd2);
-    auto cosphi1 = std::cos(std::pow(integral.GetUpperLimit(), subst));
+    auto subst = theta_substitution(energy);
+    auto cosphi0 = std::cos(
+        std::pow(SampleSubstitutedTheta(energy, rho, comp, rnd1), subst));
+    auto cosphi1 = std::cos(
+        std::pow(SampleSubstitutedTheta(energy, rho, comp, rnd2), subst));
     auto theta0 = rnd3 * 2. * PI;
     auto theta1 = std::fmod(theta0 + PI, 2. * PI);
     // TODO: Sometimes the integration fails and -1 instead of 1 is returned...
@@ -19,7 +19,7 @@ void init_decay(py::module& m) {
         .def("__str__", &py_print<DecayChannel>)
         .def("__eq__", &DecayChannel::operator==)
         .def("__ne__", &DecayChannel::operator!=)
-        .def("decay", &DecayChannel::Decay, "Decay the given particle")
+        .def("decay", overload_cast_<const ParticleDef&, const ParticleState&>()(&DecayChannel::Decay), "Decay the given particle")
         .def_static("boost", overload_cast_<ParticleState&, const Vector3D&, double, double>()(&DecayChannel::Boost))
         .def_static("boost", overload_cast_<std::vector<ParticleState>&, const Vector3D&, double, double>()(&DecayChannel::Boost));
 
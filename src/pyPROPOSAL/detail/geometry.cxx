@@ -1,6 +1,8 @@
 
 #include "PROPOSAL/geometry/Box.h"
 #include "PROPOSAL/geometry/Cylinder.h"
+#include "PROPOSAL/geometry/LayeredSphere.h"
+#include "PROPOSAL/geometry/Mesh.h"
 #include "PROPOSAL/geometry/Sphere.h"
 #include "pyPROPOSAL/pyBindings.h"
 
@@ -24,7 +26,8 @@ void init_geometry(py::module& m) {
     py::enum_<Geometry_Type>(m_sub, "Shape")
         .value("Sphere", Geometry_Type::SPHERE)
         .value("Box", Geometry_Type::BOX)
-        .value("Cylinder", Geometry_Type::CYLINDER);
+        .value("Cylinder", Geometry_Type::CYLINDER)
+        .value("Mesh", Geometry_Type::MESH);
 
     py::class_<Geometry, std::shared_ptr<Geometry>>(m_sub, "Geometry")
         .def("__str__", &py_print<Geometry>)
@@ -118,6 +121,51 @@ void init_geometry(py::module& m) {
                 outer radius of the sphere
             )pbdoc");
 
+    py::class_<LayeredSphere, std::shared_ptr<LayeredSphere>, Geometry>(m_sub, "LayeredSphere")
+        .def(py::init<const Vector3D&, std::vector<double>>(),
+             py::arg("position"), py::arg("radii"))
+        .def("layer", &LayeredSphere::GetLayer,
+             R"pbdoc(
+            Layer enclosing the particle position.
+
+            Parameters:
+                arg0 (Vector3D): particle position
+
+            Return:
+                int: index of the layer
+        )pbdoc")
+        .def("distance_to_layer_border", &LayeredSphere::DistanceToLayerBorder,
+             R"pbdoc(
+            Distance to the next border of any layer.
+
+            Parameters:
+                arg0 (Vector3D): particle position
+                arg1 (Vector3D): particle direction
+
+            Return:
+                float: distance, -1 if there is no intersection
+        )pbdoc")
+        .def_property_readonly("radii", &LayeredSphere::GetRadii,
+                      R"pbdoc(
+                borders of the layers
+            )pbdoc");
+
+    py::class_<Mesh, std::shared_ptr<Mesh>, Geometry>(m_sub, "Mesh",
+                                                      R"pbdoc(
+                Closed surface given by triangles. The mesh has to be
+                watertight, since the number of intersections decides
+                whether a particle is inside.
+            )pbdoc")
+        .def(py::init<const Vector3D&, const std::vector<std::array<double, 3>>&,
+                 const std::vector<std::array<size_t, 3>>&>(),
+            py::arg("position"), py::arg("vertices"), py::arg("triangles"))
+        .def(py::init<const Vector3D&, const std::string&, double>(),
+            py::arg("position"), py::arg("path"), py::arg("scale") = 1.,
+            R"pbdoc(
+                Reads the mesh from a Wavefront OBJ or ASCII PLY file.
+            )pbdoc")
+        .def_property_readonly("number_of_triangles", &Mesh::GetNumberOfTriangles);
+
     py::class_<Box, std::shared_ptr<Box>, Geometry>(m_sub, "Box")
         .def(py::init<const Vector3D&, double, double, double>(),
             py::arg("position"), py::arg("x"), py::arg("y"), py::arg("z")
@@ -14,6 +14,18 @@
 namespace py = pybind11;
 using namespace PROPOSAL;
 
+// Read-only numpy view on a column of the Secondaries track. The Secondaries
+// object is used as base, so it is kept alive as long as the view exists.
+template <typename T, typename V>
+py::array_t<T> track_view(V const& column, std::vector<py::ssize_t> shape,
+                          py::handle base) {
+    auto arr = py::array_t<T>(shape,
+            reinterpret_cast<const T*>(column.data()), base);
+    py::detail::array_proxy(arr.ptr())->flags
+        &= ~py::detail::npy_api::NPY_ARRAY_WRITEABLE_;
+    return arr;
+}
+
 void init_particle(py::module& m) {
     py::module m_sub = m.def_submodule("particle");
 
@@ -490,6 +502,71 @@ void init_particle(py::module& m) {
                 Returns:
                     List of doubles, describing the particle propagated distances during propgation (in cm)
                  )pbdoc")
+            .def("track_positions_array",
+                 [](py::object self) {
+                     auto& column = self.cast<const Secondaries&>().GetTrackPositionCoordinates();
+                     return track_view<double>(column, {static_cast<py::ssize_t>(column.size()), 3}, self);
+                 },
+                 R"pbdoc(
+                Returns the positions (in cm) of the propagated particle as a read-only numpy array of shape (n, 3).
+                The array is a view on the data stored in the Secondaries object, no copy is made.
+                )pbdoc")
+            .def("track_directions_array",
+                 [](py::object self) {
+                     auto& column = self.cast<const Secondaries&>().GetTrackDirectionCoordinates();
+                     return track_view<double>(column, {static_cast<py::ssize_t>(column.size()), 3}, self);
+                 },
+                 R"pbdoc(
+                Returns the directions of the propagated particle as a read-only numpy array of shape (n, 3).
+                The array is a view on the data stored in the Secondaries object, no copy is made.
+                )pbdoc")
+            .def("track_energies_array",
+                 [](py::object self) {
+                     auto& column = self.cast<const Secondaries&>().GetTrackEnergies();
+                     return track_view<double>(column, {static_cast<py::ssize_t>(column.size())}, self);
+                 },
+                 R"pbdoc(
+                Returns the energies (in MeV) of the propagated particle as a read-only numpy array.
+                The array is a view on the data stored in the Secondaries object, no copy is made.
+                )pbdoc")
+            .def("track_times_array",
+                 [](py::object self) {
+                     auto& column = self.cast<const Secondaries&>().GetTrackTimes();
+                     return track_view<double>(column, {static_cast<py::ssize_t>(column.size())}, self);
+                 },
+                 R"pbdoc(
+                Returns the times (in s) of the propagated particle as a read-only numpy array.
+                The array is a view on the data stored in the Secondaries object, no copy is made.
+                )pbdoc")
+            .def("track_propagated_distances_array",
+                 [](py::object self) {
+                     auto& column = self.cast<const Secondaries&>().GetTrackPropagatedDistances();
+                     return track_view<double>(column, {static_cast<py::ssize_t>(column.size())}, self);
+                 },
+                 R"pbdoc(
+                Returns the propagated distances (in cm) of the propagated particle as a read-only numpy array.
+                The array is a view on the data stored in the Secondaries object, no copy is made.
+                )pbdoc")
+            .def("track_types_array",
+                 [](py::object self) {
+                     auto& column = self.cast<const Secondaries&>().GetTrackTypes();
+                     static_assert(sizeof(InteractionType) == sizeof(int), "InteractionType must be int sized.");
+                     return track_view<int>(column, {static_cast<py::ssize_t>(column.size())}, self);
+                 },
+                 R"pbdoc(
+                Returns the interaction types of the track as a read-only numpy array of integers, which can be
+                compared to the values of :meth:`particle.Interaction_Type`. The array is a view on the data stored
+                in the Secondaries object, no copy is made.
+                )pbdoc")
+            .def("target_hashes_array",
+                 [](py::object self) {
+                     auto& column = self.cast<const Secondaries&>().GetTargetHashes();
+                     return track_view<size_t>(column, {static_cast<py::ssize_t>(column.size())}, self);
+                 },
+                 R"pbdoc(
+                Returns the target hashes of the track as a read-only numpy array. The array is a view on the data
+                stored in the Secondaries object, no copy is made.
+                )pbdoc")
             .def("track_types",
                  &Secondaries::GetTrackTypes,
                  R"pbdoc(
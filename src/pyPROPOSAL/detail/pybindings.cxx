@@ -3,6 +3,8 @@
 #include "PROPOSAL/Constants.h"
 #include "PROPOSAL/EnergyCutSettings.h"
 #include "PROPOSAL/Logging.h"
+#include "PROPOSAL/BatchPropagator.h"
+#include "PROPOSAL/Cascade.h"
 #include "PROPOSAL/Propagator.h"
 #include "PROPOSAL/math/Spherical3D.h"
 #include "PROPOSAL/version.h"
@@ -237,6 +239,20 @@ PYBIND11_MODULE(proposal, m)
         .def_readwrite_static(
             "nodes_rate_interpolant", &InterpolationSettings::NODES_RATE_INTERPOLANT);
 
+    py::class_<IntegrationSettings, std::shared_ptr<IntegrationSettings>>
+        integration_settings(m, "IntegrationSettings");
+    py::enum_<IntegrationSettings::Method>(integration_settings, "Method")
+        .value("adaptive", IntegrationSettings::ADAPTIVE)
+        .value("gauss_legendre", IntegrationSettings::GAUSS_LEGENDRE)
+        .value("verify", IntegrationSettings::VERIFY);
+    integration_settings
+        .def_readwrite_static(
+            "inner_integration", &IntegrationSettings::INNER_INTEGRATION)
+        .def_readwrite_static(
+            "gauss_legendre_order", &IntegrationSettings::GAUSS_LEGENDRE_ORDER)
+        .def_readwrite_static("verification_tolerance",
+            &IntegrationSettings::VERIFICATION_TOLERANCE);
+
     py::class_<PropagationSettings, std::shared_ptr<PropagationSettings>>(
             m, "PropagationSettings")
             .def_readwrite_static(
@@ -375,7 +391,12 @@ PYBIND11_MODULE(proposal, m)
     py::class_<Time, std::shared_ptr<Time>>(m, "Time")
         .def("elapsed", &Time::TimeElapsed, py::arg("initial_energy"),
             py::arg("final_energy"), py::arg("grammage"),
-            py::arg("local_density"));
+            py::arg("local_density"))
+        .def("grammage_and_elapsed",
+            py::overload_cast<Displacement&, double, double, double>(
+                &Time::GrammageAndTimeElapsed),
+            py::arg("displacement"), py::arg("initial_energy"),
+            py::arg("final_energy"), py::arg("local_density"));
 
     m.def("make_time",
         [](crosssection_list_t cross,
@@ -412,6 +433,9 @@ PYBIND11_MODULE(proposal, m)
         .def("energy_randomize", &PropagationUtility::EnergyRandomize)
         .def("energy_distance", &PropagationUtility::EnergyDistance)
         .def("length_continuous", &PropagationUtility::LengthContinuous)
+        .def("length_and_time_continuous",
+            py::overload_cast<double, double, double>(
+                &PropagationUtility::LengthAndTimeContinuous))
         .def("directions_scatter", &PropagationUtility::DirectionsScatter);
 
     /* .def(py::init<const Utility&, const InterpolationDef>(), */
@@ -455,9 +479,57 @@ PYBIND11_MODULE(proposal, m)
         .def(py::init<const ParticleDef&, std::vector<Sector>>())
         .def(py::init<const ParticleDef&, const std::string&>(),
             py::arg("particle_def"), py::arg("path_to_config_file"))
-        .def("propagate", &Propagator::Propagate, py::arg("initial_particle"),
+        .def("propagate",
+            overload_cast_<const ParticleState&, double, double, unsigned int>()(
+                &Propagator::Propagate),
+            py::arg("initial_particle"), py::arg("max_distance") = 1.e20,
+            py::arg("min_energy") = 0., py::arg("hierarchy_condition") = 0)
+        .def("propagate",
+            overload_cast_<const ParticleState&, Propagator::TrackSink, double,
+                double, unsigned int>()(&Propagator::Propagate),
+            py::arg("initial_particle"), py::arg("sink"),
             py::arg("max_distance") = 1.e20, py::arg("min_energy") = 0.,
-            py::arg("hierarchy_condition") = 0);
+            py::arg("hierarchy_condition") = 0,
+            R"pbdoc(
+                Propagate the particle without storing the track. The callable
+                sink is invoked with (particle_state, interaction_type,
+                target_hash) for every state that would be part of the
+                Secondaries track.
+            )pbdoc");
+
+    py::class_<BatchPropagator, std::shared_ptr<BatchPropagator>>(
+        m, "BatchPropagator")
+        .def(py::init<const ParticleDef&, std::vector<Sector>>())
+        .def(py::init<const Propagator&>(), py::arg("propagator"))
+        .def("propagate", &BatchPropagator::Propagate,
+            py::arg("initial_particles"), py::arg("max_distance") = 1.e20,
+            py::arg("min_energy") = 0., py::arg("hierarchy_condition") = 0,
+            R"pbdoc(
+                Propagate a list of particles in lock-step. Returns one
+                Secondaries object per initial particle.
+            )pbdoc");
+
+    py::class_<CascadeNode>(m, "CascadeNode")
+        .def_readonly("initial_state", &CascadeNode::initial_state)
+        .def_readonly("final_state", &CascadeNode::final_state)
+        .def_readonly("parent", &CascadeNode::parent)
+        .def_readonly("origin", &CascadeNode::origin)
+        .def_readonly("propagated", &CascadeNode::propagated);
+
+    py::class_<Cascade, std::shared_ptr<Cascade>>(m, "Cascade")
+        .def(py::init<std::vector<ParticleDef>, const std::string&,
+                 const Medium&, double, size_t>(),
+            py::arg("particle_defs"), py::arg("path_to_config_file"),
+            py::arg("medium"),
+            py::arg("energy_threshold"), py::arg("n_threads") = 1)
+        .def("propagate", &Cascade::Propagate,
+            py::call_guard<py::gil_scoped_release>(),
+            py::arg("primary"), py::arg("max_distance") = 1.e20,
+            R"pbdoc(
+                Propagate the primary and all secondaries above the energy
+                threshold. Returns the cascade as a list of nodes, each node
+                refers to the index of its parent.
+            )pbdoc");
 
     /* py::class_<PropagatorService, std::shared_ptr<PropagatorService>>( */
     /*     m, "PropagatorService") */
@@ -12,6 +12,20 @@
 namespace py = pybind11;
 using namespace PROPOSAL;
 
+namespace {
+// python passes as many random numbers as the deflection requires
+stochastic_deflection::RandomNumbers to_random_numbers(
+    std::vector<double> const& rnd)
+{
+    if (rnd.size() > stochastic_deflection::MAX_RANDOM_NUMBERS)
+        throw std::invalid_argument(
+            "Too many random numbers for a stochastic deflection.");
+    auto random_numbers = stochastic_deflection::RandomNumbers();
+    std::copy(rnd.begin(), rnd.end(), random_numbers.begin());
+    return random_numbers;
+}
+} // namespace
+
 void init_scattering(py::module& m)
 {
     py::module m_sub = m.def_submodule("scattering");
@@ -34,7 +48,7 @@ void init_scattering(py::module& m)
 
     py::class_<multiple_scattering::Highland, multiple_scattering::Parametrization,
         std::shared_ptr<multiple_scattering::Highland>>(m_sub, "Highland")
-        .def("CalculateTheta0", &multiple_scattering::Highland::CalculateTheta0,
+        .def("CalculateTheta0", py::overload_cast<double, double, double>(&multiple_scattering::Highland::CalculateTheta0),
              py::arg("grammage"), py::arg("e_i"), py::arg("e_f"),
              R"pbdoc(
                 Calculate the average scattering angle for Highland
@@ -97,8 +111,11 @@ void init_scattering(py::module& m)
             &stochastic_deflection::Parametrization::GetInteractionType,
             R"pbdoc(Interaction type which causes the stochastic deflection calculation)pbdoc")
         .def("stochastic_deflection",
-            &stochastic_deflection::Parametrization::
-                CalculateStochasticDeflection,
+            [](stochastic_deflection::Parametrization const& self, double e_i,
+                double e_f, std::vector<double> const& rnd, size_t component) {
+                return self.CalculateStochasticDeflection(
+                    e_i, e_f, to_random_numbers(rnd), component);
+            },
             py::arg("initial_energy"), py::arg("final_energy"),
             py::arg("random_numbers"), py::arg("component"),
             R"pbdoc( Calculation of the stochastic deflection of an interaction
@@ -162,8 +179,11 @@ void init_scattering(py::module& m)
             Returns:
                 int: required rnd numbers)pbdoc")
         .def("stochastic_deflection",
-            &Scattering::CalculateStochasticDeflection<double, double,
-                std::vector<double> const&, size_t>,
+            [](Scattering& self, InteractionType t, double e_i, double e_f,
+                std::vector<double> const& rnd, size_t component) {
+                return self.CalculateStochasticDeflection(
+                    t, e_i, e_f, to_random_numbers(rnd), component);
+            },
             py::arg("type"), py::arg("initial_energy"), py::arg("final_energy"),
             py::arg("rnd"), py::arg("component"),
             R"pbdoc(Sample stochastic defleciton angles in radians.
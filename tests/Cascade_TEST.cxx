@@ -0,0 +1,122 @@
+#include "gtest/gtest.h"
+#include "PROPOSAL/Cascade.h"
+#include "PROPOSAL/crosssection/ParticleDefaultCrossSectionList.h"
+#include "PROPOSAL/density_distr/density_homogeneous.h"
+#include "PROPOSAL/geometry/Sphere.h"
+#include "PROPOSAL/math/RandomGenerator.h"
+#include "PROPOSAL/particle/Particle.h"
+#include "PROPOSAL/propagation_utility/InteractionBuilder.h"
+#include "PROPOSAL/propagation_utility/TimeBuilder.h"
+#include "PROPOSAL/secondaries/parametrization/annihilation/HeitlerAnnihilation.h"
+#include "PROPOSAL/secondaries/parametrization/bremsstrahlung/BremsNoDeflection.h"
+#include "PROPOSAL/secondaries/parametrization/compton/NaivCompton.h"
+#include "PROPOSAL/secondaries/parametrization/epairproduction/KelnerKokoulinPetrukhinEpairProduction.h"
+#include "PROPOSAL/secondaries/parametrization/ionization/NaivIonization.h"
+#include "PROPOSAL/secondaries/parametrization/photoeffect/PhotoeffectNoDeflection.h"
+#include "PROPOSAL/secondaries/parametrization/photopairproduction/PhotoPairProductionTsai.h"
+
+using namespace PROPOSAL;
+
+namespace {
+Cascade::Handler make_handler(const ParticleDef& p_def)
+{
+    auto medium = Ice();
+    auto cuts = std::make_shared<EnergyCutSettings>(INF, 0.05, false);
+    auto cross = GetStdCrossSections(p_def, medium, cuts, true);
+
+    auto collection = PropagationUtility::Collection();
+    collection.interaction_calc = make_interaction(cross, true);
+    collection.displacement_calc = make_displacement(cross, true);
+    collection.time_calc = make_time(cross, p_def, true);
+
+    auto density_distr = std::make_shared<Density_homogeneous>(medium);
+    auto world = std::make_shared<Sphere>(Cartesian3D(0, 0, 0), 1e20);
+    std::vector<Sector> sectors = { std::make_tuple(
+        world, PropagationUtility(collection), density_distr) };
+
+    auto handler = Cascade::Handler();
+    handler.propagator = PROPOSAL::make_unique<Propagator>(p_def, sectors);
+    handler.secondaries = PROPOSAL::make_unique<SecondariesCalculator>();
+    auto& sec = *handler.secondaries;
+    if (p_def == GammaDef()) {
+        sec.addInteraction(PROPOSAL::make_unique<
+            secondaries::PhotoPairProductionTsaiForwardPeaked>(p_def, medium));
+        sec.addInteraction(
+            PROPOSAL::make_unique<secondaries::NaivCompton>(p_def, medium));
+        sec.addInteraction(PROPOSAL::make_unique<
+            secondaries::PhotoeffectNoDeflection>(p_def, medium));
+    } else {
+        sec.addInteraction(PROPOSAL::make_unique<
+            secondaries::BremsNoDeflection>(p_def, medium));
+        sec.addInteraction(
+            PROPOSAL::make_unique<secondaries::NaivIonization>(p_def, medium));
+        sec.addInteraction(PROPOSAL::make_unique<
+            secondaries::KelnerKokoulinPetrukhinEpairProduction>(p_def, medium));
+        if (p_def == EPlusDef())
+            sec.addInteraction(PROPOSAL::make_unique<
+                secondaries::HeitlerAnnihilation>(p_def, medium));
+    }
+    return handler;
+}
+}
+
+TEST(Cascade, TreeConsistency)
+{
+    auto threshold = 50.;
+    auto p_defs
+        = std::vector<ParticleDef> { GammaDef(), EMinusDef(), EPlusDef() };
+
+    auto init_state = ParticleState();
+    init_state.SetType(ParticleType::Gamma);
+    init_state.energy = 1e3;
+    init_state.position = Cartesian3D(0, 0, 0);
+    init_state.direction = Cartesian3D(0, 0, 1);
+
+    auto single = Cascade(p_defs, make_handler, threshold, 1);
+    auto parallel = Cascade(p_defs, make_handler, threshold, 2);
+    for (int seed = 0; seed < 10; seed++) {
+        RandomGenerator::Get().SetSeed(seed);
+        auto nodes = single.Propagate(init_state);
+        ASSERT_FALSE(nodes.empty());
+        EXPECT_EQ(nodes.front().parent, -1);
+        EXPECT_EQ(nodes.front().initial_state, init_state);
+
+        auto children_energy = std::vector<double>(nodes.size(), 0.);
+        for (size_t n = 1; n < nodes.size(); n++) {
+            auto const& node = nodes[n];
+            ASSERT_GE(node.parent, 0);
+            ASSERT_LT(node.parent, static_cast<int>(n));
+            EXPECT_EQ(node.propagated, node.initial_state.energy > threshold);
+            if (node.propagated)
+                EXPECT_LE(node.final_state.energy, threshold);
+            else
+                EXPECT_EQ(node.final_state, node.initial_state);
+            children_energy[node.parent] += node.initial_state.energy;
+        }
+
+        // secondaries can not carry more energy than their parent, except
+        // for the rest mass of ionized electrons
+        for (size_t n = 0; n < nodes.size(); n++) {
+            EXPECT_LE(children_energy[n],
+                nodes[n].initial_state.energy * (1 + 1e-6) + 10 * ME);
+        }
+
+        // the cascade only depends on the seed of the global generator, not
+        // on the number of threads
+        RandomGenerator::Get().SetSeed(seed);
+        auto nodes_parallel = parallel.Propagate(init_state);
+        ASSERT_EQ(nodes_parallel.size(), nodes.size());
+        for (size_t n = 0; n < nodes.size(); n++) {
+            EXPECT_EQ(nodes_parallel[n].initial_state, nodes[n].initial_state);
+            EXPECT_EQ(nodes_parallel[n].final_state, nodes[n].final_state);
+            EXPECT_EQ(nodes_parallel[n].parent, nodes[n].parent);
+            EXPECT_EQ(nodes_parallel[n].origin, nodes[n].origin);
+        }
+    }
+}
+
+int main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -180,6 +180,34 @@ TEST(ContinuousRandomization, compare_integral_interpolant)
     }
 }
 
+TEST(ContinuousRandomization, compare_variance_integral_interpolant)
+{
+    // the tabulated variance should agree with the integral for long and
+    // short steps, and the randomized energy stay within its limits
+    auto p_def = MuMinusDef();
+    auto medium = Ice();
+    auto cuts = std::make_shared<EnergyCutSettings>(INF, 1, true);
+    auto cross = GetStdCrossSections(p_def, medium, cuts, true);
+    auto contrand_integral = make_contrand(cross, false);
+    auto contrand_interpol = make_contrand(cross, true);
+
+    RandomGenerator::Get().SetSeed(24601);
+    for (double logE_i = 3.; logE_i < 12.; logE_i += 0.5) {
+        auto E_i = std::pow(10., logE_i);
+        for (auto E_f : { 0.1 * E_i, 0.9 * E_i }) {
+            auto variance_integral = contrand_integral->Variance(E_i, E_f);
+            auto variance_interpol = contrand_interpol->Variance(E_i, E_f);
+            EXPECT_NEAR(variance_interpol, variance_integral,
+                1e-3 * variance_integral);
+
+            auto randomized = contrand_interpol->EnergyRandomize(
+                E_i, E_f, RandomGenerator::Get().RandomDouble());
+            EXPECT_GE(randomized, p_def.mass);
+            EXPECT_LE(randomized, E_i);
+        }
+    }
+}
+
 TEST(ContinuousRandomization, Randomize_interpol)
 {
     std::ifstream in;
@@ -941,6 +941,126 @@ TEST(DecaySpectrum, TauMinus_energy)
     in.close();
 }
 
+TEST(DecaySpectrum, MichelSpectrumMean)
+{
+    // In the limit of a massless electron the energy fraction x = E / E_max
+    // follows the density 2 x^2 (3 - 2 x) with a mean value of 0.7.
+    RandomGenerator::Get().SetSeed(1234);
+
+    ParticleState init_particle;
+    init_particle.type = mu.particle_type;
+    init_particle.energy = mu.mass;
+    init_particle.direction = Cartesian3D(0, 0, -1);
+
+    double e_max = (mu.mass * mu.mass + eminus.mass * eminus.mass) / (2 * mu.mass);
+
+    LeptonicDecayChannelApprox lep_approx(eminus, nue, nuebar);
+    LeptonicDecayChannel lep(eminus, nue, nuebar);
+    std::vector<DecayChannel*> channels = { &lep_approx, &lep };
+
+    int statistic = 1e5;
+    std::vector<ParticleState> products;
+    for (auto channel : channels) {
+        double sum = 0;
+        for (int i = 0; i < statistic; i++) {
+            channel->Decay(mu, init_particle, products);
+            ASSERT_EQ(products.size(), 3);
+            EXPECT_GE(products[0].energy, eminus.mass);
+            EXPECT_LE(products[0].energy, e_max * (1 + 1e-10));
+            sum += products[0].energy / e_max;
+        }
+        EXPECT_NEAR(sum / statistic, 0.7, 3e-3);
+    }
+}
+
+TEST(ManyBodyPhaseSpace, BatchDecay)
+{
+    // decaying particles at once gives the same products as single decays
+    std::vector<std::shared_ptr<const ParticleDef>> daughters = {
+        std::make_shared<ParticleDef>(eminus),
+        std::make_shared<ParticleDef>(nue),
+        std::make_shared<ParticleDef>(nuebar),
+    };
+
+    std::vector<ParticleState> init_particles;
+    for (auto energy : { 105.7, 1e3, 1e5, 1e7 }) {
+        ParticleState init_particle;
+        init_particle.type = mu.particle_type;
+        init_particle.energy = energy;
+        init_particle.direction = Cartesian3D(0, 0, -1);
+        init_particle.position = Cartesian3D(0, 0, -1);
+        init_particles.push_back(init_particle);
+    }
+
+    for (auto matrix_element :
+        { ManyBodyPhaseSpace::MatrixElementFunction(nullptr),
+            ManyBodyPhaseSpace::MatrixElementFunction(
+                matrix_element_evaluate) }) {
+        ManyBodyPhaseSpace many_body(daughters, matrix_element);
+        // the estimation of the maximal weight draws random numbers as well
+        many_body.Decay(mu, init_particles.front());
+
+        RandomGenerator::Get().SetSeed(1234);
+        std::vector<ParticleState> single;
+        for (auto& init_particle : init_particles) {
+            auto products = many_body.Decay(mu, init_particle);
+            single.insert(single.end(), products.begin(), products.end());
+        }
+
+        RandomGenerator::Get().SetSeed(1234);
+        std::vector<ParticleState> batch;
+        many_body.Decay(mu, init_particles, batch);
+
+        ASSERT_EQ(batch.size(), 3 * init_particles.size());
+        for (size_t i = 0; i < batch.size(); ++i) {
+            EXPECT_EQ(batch[i].type, single[i].type);
+            EXPECT_DOUBLE_EQ(batch[i].energy, single[i].energy);
+            EXPECT_DOUBLE_EQ(batch[i].direction.GetZ(), single[i].direction.GetZ());
+        }
+
+        for (size_t i = 0; i < init_particles.size(); ++i) {
+            double energy_sum = 0;
+            for (size_t j = 0; j < 3; ++j)
+                energy_sum += batch[3 * i + j].energy;
+            EXPECT_NEAR(energy_sum, init_particles[i].energy,
+                1e-8 * init_particles[i].energy);
+        }
+    }
+}
+
+TEST(ManyBodyPhaseSpace, CopiesShareParameters)
+{
+    // a copy of a channel which already decayed does not estimate the
+    // maximal weight again, so it draws the same random numbers
+    std::vector<std::shared_ptr<const ParticleDef>> daughters = {
+        std::make_shared<ParticleDef>(eminus),
+        std::make_shared<ParticleDef>(nue),
+        std::make_shared<ParticleDef>(nuebar),
+    };
+
+    ParticleState init_particle;
+    init_particle.type = mu.particle_type;
+    init_particle.energy = 1e3;
+    init_particle.direction = Cartesian3D(0, 0, -1);
+
+    ManyBodyPhaseSpace many_body(daughters, matrix_element_evaluate);
+    many_body.Decay(mu, init_particle);
+
+    RandomGenerator::Get().SetSeed(1234);
+    auto products = many_body.Decay(mu, init_particle);
+
+    std::unique_ptr<DecayChannel> copy(many_body.clone());
+    RandomGenerator::Get().SetSeed(1234);
+    auto products_copy = copy->Decay(mu, init_particle);
+
+    ASSERT_EQ(products.size(), products_copy.size());
+    for (size_t i = 0; i < products.size(); ++i) {
+        EXPECT_DOUBLE_EQ(products[i].energy, products_copy[i].energy);
+        EXPECT_DOUBLE_EQ(
+            products[i].direction.GetZ(), products_copy[i].direction.GetZ());
+    }
+}
+
 int main(int argc, char** argv)
 {
     ::testing::InitGoogleTest(&argc, argv);
@@ -177,6 +177,48 @@ TEST(SelectChannel, Tau)
     EXPECT_TRUE(twobody_count > 0);
 }
 
+TEST(SelectChannel, BranchingRatios)
+{
+    // channels are selected with the frequency of their branching ratio,
+    // which do not have to be normalized
+    DecayTable table;
+    table.addChannel(0.1, StableChannel());
+    table.addChannel(0.3, TwoBodyPhaseSpace(eminus, nue));
+    table.addChannel(0.6, LeptonicDecayChannel(eminus, nue, nuebar));
+
+    int stable_count = 0;
+    int twobody_count = 0;
+    int leptonic_count = 0;
+    int statistic = 100000;
+
+    for (int i = 0; i < statistic; ++i)
+    {
+        DecayChannel& dc = table.SelectChannel((i + 0.5) / statistic);
+
+        if (dynamic_cast<StableChannel*>(&dc))
+        {
+            stable_count++;
+        } else if (dynamic_cast<TwoBodyPhaseSpace*>(&dc))
+        {
+            twobody_count++;
+        } else if (dynamic_cast<LeptonicDecayChannel*>(&dc))
+        {
+            leptonic_count++;
+        }
+    }
+
+    EXPECT_NEAR(stable_count, 0.1 * statistic, 2);
+    EXPECT_NEAR(twobody_count, 0.3 * statistic, 2);
+    EXPECT_NEAR(leptonic_count, 0.6 * statistic, 2);
+
+    // the border values of the random number are valid as well
+    EXPECT_NO_THROW(table.SelectChannel(0.));
+    EXPECT_NO_THROW(table.SelectChannel(1.));
+
+    DecayTable empty;
+    EXPECT_THROW(empty.SelectChannel(0.5), std::out_of_range);
+}
+
 int main(int argc, char** argv)
 {
     ::testing::InitGoogleTest(&argc, argv);
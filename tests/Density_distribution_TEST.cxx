@@ -1,4 +1,6 @@
 
+#include <cmath>
+
 #include "gtest/gtest.h"
 
 #include "PROPOSAL/density_distr/density_exponential.h"
@@ -98,6 +100,41 @@ TEST(Assignment, Copyconstructor)
     EXPECT_TRUE(A == C);
 }
 
+TEST(Correct, InverseOfCalculate)
+{
+    std::vector<double> depth, density;
+    for (int i = 0; i <= 100; ++i) {
+        depth.push_back(-1000. + 20. * i);
+        density.push_back(1. + 0.5 * std::sin(0.05 * i));
+    }
+    Cubic_Spline spline(depth, density);
+    Polynom poly(std::vector<double>{1., 1e-3, 1e-6});
+
+    RadialAxis radial(Cartesian3D(0, 0, -600));
+    CartesianAxis cartesian(Cartesian3D(0, 0, 1), Cartesian3D(0, 0, 0));
+    std::vector<std::pair<Axis*, Cartesian3D>> axes = {
+        {&radial, Cartesian3D(-0.6, 0, -0.8)},
+        {&cartesian, Cartesian3D(0.6, 0, 0.8)}};
+
+    Cartesian3D position(10, 20, -30);
+    for (auto& axis_direction : axes) {
+        auto axis = axis_direction.first;
+        auto direction = axis_direction.second;
+        Density_splines dens_splines(*axis, spline, 1.);
+        Density_polynomial dens_poly(*axis, poly, 1.);
+        std::vector<Density_distr*> distributions = {&dens_splines, &dens_poly};
+        for (auto dens : distributions) {
+            for (double grammage : {1e-2, 1., 10., 100.}) {
+                auto distance = dens->Correct(position, direction, grammage, 400.);
+                EXPECT_NEAR(dens->Calculate(position, direction, distance),
+                    grammage, 1e-6 * grammage + 1e-9);
+            }
+            EXPECT_THROW(dens->Correct(position, direction, 1e5, 400.),
+                DensityException);
+        }
+    }
+}
+
 int main(int argc, char** argv)
 {
     ::testing::InitGoogleTest(&argc, argv);
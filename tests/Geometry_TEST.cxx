@@ -1,11 +1,16 @@
 
+#include <fstream>
 #include <iostream>
 #include "gtest/gtest.h"
+#include <nlohmann/json.hpp>
 
 #include "PROPOSAL/Constants.h"
 #include "PROPOSAL/geometry/Box.h"
 #include "PROPOSAL/geometry/Cylinder.h"
 #include "PROPOSAL/geometry/Geometry.h"
+#include "PROPOSAL/geometry/GeometryFactory.h"
+#include "PROPOSAL/geometry/LayeredSphere.h"
+#include "PROPOSAL/geometry/Mesh.h"
 #include "PROPOSAL/geometry/Sphere.h"
 #include "PROPOSAL/math/RandomGenerator.h"
 #include "PROPOSAL/math/Spherical3D.h"
@@ -1197,6 +1202,222 @@ TEST(DistanceTo, Box)
     }
 }
 
+TEST(DistanceTo, LayeredSphere)
+{
+    Cartesian3D center(1, -2, 3);
+    std::vector<double> radii = {0, 1, 2.5, 3, 7, 10};
+    LayeredSphere A(center, radii);
+
+    std::vector<Sphere> shells;
+    for (size_t i = 0; i + 1 < radii.size(); ++i)
+        shells.emplace_back(center, radii[i + 1], radii[i]);
+
+    Cartesian3D particle_position;
+    Spherical3D particle_direction;
+    for (int i = 0; i < 1e4; i++)
+    {
+        // random positions inside and outside, some of them on the borders
+        auto radius = 12 * RandomGenerator::Get().RandomDouble();
+        if (i % 10 == 0)
+            radius = radii[i / 10 % radii.size()];
+        Spherical3D offset(radius, 2 * PI * RandomGenerator::Get().RandomDouble(),
+            PI * RandomGenerator::Get().RandomDouble());
+        particle_position = Cartesian3D(center) + Cartesian3D(offset);
+        particle_direction.SetCoordinates({1,
+            2 * PI * RandomGenerator::Get().RandomDouble(),
+            PI * RandomGenerator::Get().RandomDouble()});
+
+        auto expected = -1.;
+        auto inside = shells.size();
+        for (size_t j = 0; j < shells.size(); ++j) {
+            auto distance = shells[j].DistanceToBorder(particle_position, particle_direction).first;
+            if (distance >= 0 && (expected < 0 || distance < expected))
+                expected = distance;
+            if (shells[j].IsInside(particle_position, particle_direction))
+                inside = j;
+        }
+        EXPECT_DOUBLE_EQ(A.DistanceToLayerBorder(particle_position, particle_direction), expected);
+
+        auto layer = A.GetLayer(particle_position);
+        if (inside < shells.size())
+            EXPECT_LE(std::abs(static_cast<int>(layer) - static_cast<int>(inside)), 1);
+        if (radius < radii.back() && std::abs(radius - radii[layer]) > 1e-6
+            && std::abs(radius - radii[layer + 1]) > 1e-6)
+            EXPECT_EQ(layer, inside);
+    }
+
+    EXPECT_THROW(LayeredSphere(center, {1}), std::invalid_argument);
+    EXPECT_THROW(LayeredSphere(center, {1, 3, 2}), std::invalid_argument);
+}
+
+TEST(GetIntersections, SameAsSingleQueries)
+{
+    Cartesian3D center(1, -2, 3);
+    std::vector<std::shared_ptr<Geometry>> geometries = {
+        std::make_shared<Sphere>(center, 5, 2),
+        std::make_shared<Cylinder>(center, 5, 2, 4),
+        std::make_shared<Box>(center, 4, 5, 6)};
+
+    Cartesian3D particle_position;
+    Spherical3D particle_direction;
+    for (auto& geometry : geometries) {
+        for (int i = 0; i < 1e4; i++)
+        {
+            particle_position.SetCoordinates({
+                center.GetX() + 16 * (RandomGenerator::Get().RandomDouble() - 0.5),
+                center.GetY() + 16 * (RandomGenerator::Get().RandomDouble() - 0.5),
+                center.GetZ() + 16 * (RandomGenerator::Get().RandomDouble() - 0.5)});
+            // start some particles on the border
+            if (i % 10 == 0) {
+                auto radial = Cartesian3D(particle_position) - center;
+                radial.normalize();
+                auto distance = geometry->DistanceToBorder(particle_position, -radial).first;
+                if (distance > 0)
+                    particle_position = Cartesian3D(particle_position) - distance * radial;
+            }
+            particle_direction.SetCoordinates({1,
+                2 * PI * RandomGenerator::Get().RandomDouble(),
+                PI * RandomGenerator::Get().RandomDouble()});
+
+            auto intersections = geometry->GetIntersections(particle_position, particle_direction);
+            auto forward = geometry->DistanceToBorder(particle_position, particle_direction);
+            auto backward = geometry->DistanceToBorder(particle_position, -Cartesian3D(particle_direction));
+            EXPECT_EQ(intersections.forward, forward);
+            EXPECT_EQ(intersections.backward, backward);
+            EXPECT_EQ(intersections.location, geometry->GetLocation(particle_position, particle_direction));
+            EXPECT_EQ(intersections.location == Geometry::ParticleLocation::InsideGeometry,
+                geometry->IsInside(particle_position, particle_direction));
+            EXPECT_EQ(intersections.is_entering, geometry->IsEntering(particle_position, particle_direction));
+            EXPECT_EQ(intersections.is_leaving, geometry->IsLeaving(particle_position, particle_direction));
+        }
+    }
+}
+
+namespace {
+// corners of a box with the given side lengths and its faces, outward
+// oriented and split into two triangles each
+std::vector<std::array<double, 3>> box_vertices(double x, double y, double z)
+{
+    return {{-x / 2, -y / 2, -z / 2}, {x / 2, -y / 2, -z / 2}, {x / 2, y / 2, -z / 2},
+        {-x / 2, y / 2, -z / 2}, {-x / 2, -y / 2, z / 2}, {x / 2, -y / 2, z / 2},
+        {x / 2, y / 2, z / 2}, {-x / 2, y / 2, z / 2}};
+}
+
+std::vector<std::array<size_t, 4>> box_faces = {{0, 3, 2, 1}, {4, 5, 6, 7},
+    {0, 1, 5, 4}, {1, 2, 6, 5}, {2, 3, 7, 6}, {3, 0, 4, 7}};
+
+std::vector<std::array<size_t, 3>> box_triangles()
+{
+    std::vector<std::array<size_t, 3>> triangles;
+    for (auto const& face : box_faces) {
+        triangles.push_back({face[0], face[1], face[2]});
+        triangles.push_back({face[0], face[2], face[3]});
+    }
+    return triangles;
+}
+} // namespace
+
+TEST(DistanceTo, Mesh)
+{
+    Cartesian3D center(1, -2, 3);
+    Box A(center, 4, 5, 6);
+    Mesh B(center, box_vertices(4, 5, 6), box_triangles());
+    EXPECT_EQ(B.GetNumberOfTriangles(), 12u);
+
+    Cartesian3D particle_position;
+    Spherical3D particle_direction;
+    for (int i = 0; i < 1e4; i++)
+    {
+        particle_position.SetCoordinates({
+            center.GetX() + 16 * (RandomGenerator::Get().RandomDouble() - 0.5),
+            center.GetY() + 16 * (RandomGenerator::Get().RandomDouble() - 0.5),
+            center.GetZ() + 16 * (RandomGenerator::Get().RandomDouble() - 0.5)});
+        particle_direction.SetCoordinates({1,
+            2 * PI * RandomGenerator::Get().RandomDouble(),
+            PI * RandomGenerator::Get().RandomDouble()});
+
+        auto expected = A.DistanceToBorder(particle_position, particle_direction);
+        auto distance = B.DistanceToBorder(particle_position, particle_direction);
+        EXPECT_NEAR(distance.first, expected.first, 1e-9);
+        EXPECT_NEAR(distance.second, expected.second, 1e-9);
+        EXPECT_EQ(B.IsInside(particle_position, particle_direction),
+            A.IsInside(particle_position, particle_direction));
+    }
+
+    // trajectories through edges and corners of the triangles
+    Cartesian3D diagonal(4, 5, 6);
+    diagonal.normalize();
+    auto distance = B.DistanceToBorder(center, diagonal);
+    EXPECT_NEAR(distance.first, std::sqrt(4 * 4 + 5 * 5 + 6 * 6) / 2., 1e-9);
+    EXPECT_EQ(distance.second, -1);
+    distance = B.DistanceToBorder(center - Cartesian3D(0, 0, 10), Cartesian3D(0, 0, 1));
+    EXPECT_NEAR(distance.first, 7, 1e-9);
+    EXPECT_NEAR(distance.second, 13, 1e-9);
+
+    EXPECT_THROW(Mesh(center, box_vertices(4, 5, 6), {}), std::invalid_argument);
+    EXPECT_THROW(Mesh(center, box_vertices(4, 5, 6), {{0, 1, 8}}), std::invalid_argument);
+}
+
+TEST(Mesh, ReadFile)
+{
+    Cartesian3D center(1, -2, 3);
+    Mesh A(center, box_vertices(4, 5, 6), box_triangles());
+    auto vertices = box_vertices(0.04, 0.05, 0.06);
+
+    {
+        std::ofstream obj("mesh_test.obj");
+        obj << "# box\no box\n";
+        for (auto const& v : vertices)
+            obj << "v " << v[0] << " " << v[1] << " " << v[2] << "\n";
+        for (auto const& face : box_faces)
+            obj << "f " << face[0] + 1 << "//1 " << face[1] + 1 << "//1 "
+                << face[2] + 1 << "//1 " << face[3] + 1 << "//1\n";
+
+        std::ofstream ply("mesh_test.ply");
+        ply << "ply\nformat ascii 1.0\ncomment box\n";
+        ply << "element vertex " << vertices.size() << "\n";
+        ply << "property float x\nproperty float y\nproperty float z\n";
+        ply << "element face " << box_faces.size() << "\n";
+        ply << "property list uchar int vertex_indices\nend_header\n";
+        for (auto const& v : vertices)
+            ply << v[0] << " " << v[1] << " " << v[2] << "\n";
+        for (auto const& face : box_faces)
+            ply << "4 " << face[0] << " " << face[1] << " " << face[2] << " " << face[3] << "\n";
+    }
+
+    Mesh B(center, "mesh_test.obj", 100);
+    Mesh C(center, "mesh_test.ply", 100);
+    EXPECT_EQ(B.GetNumberOfTriangles(), 12u);
+    EXPECT_EQ(C.GetNumberOfTriangles(), 12u);
+
+    nlohmann::json config = {{"shape", "mesh"}, {"origin", {1, -2, 3}},
+        {"file", "mesh_test.ply"}, {"scale", 100}};
+    auto D = CreateGeometry(config);
+    EXPECT_EQ(D->GetName(), "mesh");
+
+    Cartesian3D particle_position;
+    Spherical3D particle_direction;
+    for (int i = 0; i < 1e3; i++)
+    {
+        particle_position.SetCoordinates({
+            center.GetX() + 16 * (RandomGenerator::Get().RandomDouble() - 0.5),
+            center.GetY() + 16 * (RandomGenerator::Get().RandomDouble() - 0.5),
+            center.GetZ() + 16 * (RandomGenerator::Get().RandomDouble() - 0.5)});
+        particle_direction.SetCoordinates({1,
+            2 * PI * RandomGenerator::Get().RandomDouble(),
+            PI * RandomGenerator::Get().RandomDouble()});
+
+        auto expected = A.DistanceToBorder(particle_position, particle_direction);
+        for (auto geometry : std::vector<const Geometry*>{&B, &C, D.get()}) {
+            auto distance = geometry->DistanceToBorder(particle_position, particle_direction);
+            EXPECT_NEAR(distance.first, expected.first, 1e-9);
+            EXPECT_NEAR(distance.second, expected.second, 1e-9);
+        }
+    }
+
+    EXPECT_THROW(Mesh(center, "mesh_test.stl"), std::invalid_argument);
+}
+
 int main(int argc, char** argv)
 {
     ::testing::InitGoogleTest(&argc, argv);
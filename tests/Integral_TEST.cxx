@@ -1,6 +1,8 @@
 
 #include "cmath"
 #include "gtest/gtest.h"
+#include "PROPOSAL/Constants.h"
+#include "PROPOSAL/math/GaussLegendre.h"
 #include "PROPOSAL/math/Integral.h"
 // #include "PROPOSAL/medium/Medium.h"
 // #include "PROPOSAL/crosssection/IonizIntegral.h"
@@ -205,6 +207,88 @@ TEST(IntegralValue, IntegrateWithLogSubstitution)
     }
 }
 
+TEST(IntegralValue, ClampedWorkspace)
+{
+    Integral Int(100, 20, 1e-6);
+    EXPECT_EQ(Int.GetRomberg(), Integral::max_romberg_order);
+
+    Int.SetMaxStepsRomberg(100);
+    EXPECT_EQ(Int.GetMaxStepsRomberg(), Integral::max_romberg_steps);
+
+    Int.SetRomberg(5);
+    double ExactIntegral = std::exp(3) - 1;
+    ASSERT_NEAR(Int.Integrate(0, 3, Testexp, 1), ExactIntegral, ExactIntegral * 1e-6);
+}
+
+TEST(IntegralValue, NonConvergingRomberg)
+{
+    // too few romberg steps, the result is calculated by qags
+    Integral Int(5, 20, 1e-10);
+    Int.SetMaxStepsRomberg(5);
+    double ExactIntegral = std::exp(3) - 1;
+    ASSERT_NEAR(Int.Integrate(0, 3, Testexp, 1), ExactIntegral, ExactIntegral * 1e-6);
+}
+
+TEST(GaussLegendre, PolynomialsAreExact)
+{
+    // a rule of order n integrates polynomials up to degree 2n - 1 exactly
+    for (unsigned int order : { 1, 2, 5, 16 }) {
+        GaussLegendre rule(order);
+        double sum_weights = 0;
+        for (auto w : rule.GetWeights())
+            sum_weights += w;
+        EXPECT_NEAR(sum_weights, 2., 1e-13);
+
+        unsigned int degree = 2 * order - 1;
+        auto pol = [degree](double x) { return std::pow(x, degree); };
+        EXPECT_NEAR(rule.Integrate(0, 2, pol), std::pow(2., degree + 1) / (degree + 1),
+            std::pow(2., degree + 1) * 1e-13);
+    }
+}
+
+TEST(GaussLegendre, IntegrateWithLog)
+{
+    GaussLegendre rule(64);
+    double ExactIntegral = std::exp(4) - std::exp(2);
+    EXPECT_NEAR(rule.Integrate(2, 4, Testexp), ExactIntegral, ExactIntegral * 1e-12);
+    EXPECT_NEAR(rule.IntegrateWithLog(2, 4, Testexp), ExactIntegral, ExactIntegral * 1e-12);
+
+    // power law over several decades
+    auto f = [](double x) { return 1. / (x * x); };
+    EXPECT_NEAR(rule.IntegrateWithLog(1e-3, 1e3, f), 1e3 - 1e-3, 1e3 * 1e-10);
+}
+
+TEST(GaussLegendre, InnerIntegration)
+{
+    auto backend = IntegrationSettings::INNER_INTEGRATION;
+    auto order = IntegrationSettings::GAUSS_LEGENDRE_ORDER;
+    double ExactIntegral = std::exp(4) - std::exp(2);
+    Integral integral(IROMB, IMAXS, IPREC);
+    for (auto method : { IntegrationSettings::ADAPTIVE,
+             IntegrationSettings::GAUSS_LEGENDRE, IntegrationSettings::VERIFY }) {
+        IntegrationSettings::INNER_INTEGRATION = method;
+        auto inner = InnerIntegration();
+        for (int i : { 1, 2, 3, 4 })
+            EXPECT_NEAR(inner.Integrate(integral, 2, 4, Testexp, i),
+                ExactIntegral, ExactIntegral * 1e-6);
+        EXPECT_EQ(inner.Integrate(integral, 3, 3, Testexp, 2), 0);
+        EXPECT_EQ(inner.Integrate(integral, 0, 3, Testexp, 4), 0);
+    }
+
+    // the settings are fixed at construction
+    IntegrationSettings::INNER_INTEGRATION = IntegrationSettings::GAUSS_LEGENDRE;
+    IntegrationSettings::GAUSS_LEGENDRE_ORDER = 2;
+    auto inner = InnerIntegration();
+    auto rule = GaussLegendre(2);
+    IntegrationSettings::INNER_INTEGRATION = IntegrationSettings::ADAPTIVE;
+    IntegrationSettings::GAUSS_LEGENDRE_ORDER = order;
+    EXPECT_TRUE(inner.IsFixedOrder());
+    EXPECT_EQ(inner.GetOrder(), 2u);
+    EXPECT_DOUBLE_EQ(inner.Integrate(integral, 2, 4, Testexp, 2),
+        rule.Integrate(2, 4, Testexp));
+    IntegrationSettings::INNER_INTEGRATION = backend;
+}
+
 // TEST(QUADPACK, RombergIntegrationFailure)
 // {
 //     double precision = 1e-4;
@@ -1,6 +1,7 @@
 #include <cmath>
 #include "gtest/gtest.h"
 #include "PROPOSAL/math/Interpolant.h"
+#include "PROPOSAL/math/TabulatedCubic.h"
 
 #ifdef WIN32
 #include <windows.h>
@@ -807,6 +808,57 @@ TEST(_2D_Interpol, All_On)
     delete Pol2;
 }
 
+TEST(TabulatedCubic, CubicIsExact)
+{
+    auto cubic = [](double x) { return 1. - 2. * x + 0.5 * x * x - 0.1 * x * x * x; };
+    std::vector<double> x = { -2., -1., 0.5, 1., 3., 4., 7. };
+    std::vector<double> y;
+    for (auto xi : x)
+        y.push_back(cubic(xi));
+
+    auto table = TabulatedCubic(x, y);
+    // including extrapolation beyond the first and last point
+    for (double xi = -3.; xi < 8.; xi += 0.1)
+        EXPECT_NEAR(table(xi), cubic(xi), 1e-10 * (1. + std::abs(cubic(xi))));
+}
+
+TEST(TabulatedCubic, SameAsInterpolantOrderFour)
+{
+    std::vector<double> x = { 3, 4, 5, 6, 7, 8, 9 };
+    std::vector<double> y = { 0.3, -1.2, 4.5, 2.2, -0.7, 1.9, 0.4 };
+
+    auto table = TabulatedCubic(x, y);
+    auto legacy = Interpolant(x, y, 4, false, false);
+    for (double xi = 2.; xi < 10.; xi += 0.05)
+        EXPECT_NEAR(table(xi), legacy.InterpolateArray(xi), 1e-10);
+}
+
+TEST(TabulatedCubic, TwoDimensionalWithMovingLimits)
+{
+    // every row covers [x1, 10], the function only depends on the relative
+    // position in this range
+    auto f = [](double x1, double x2) {
+        auto u = (x2 - x1) / (10. - x1);
+        return x1 * x1 + u * u * u;
+    };
+    std::vector<double> x1, x2_row;
+    std::vector<std::vector<double>> x2, y;
+    for (int i = 0; i < 10; ++i) {
+        x1.push_back(0.5 * i);
+        x2.emplace_back();
+        y.emplace_back();
+        for (int j = 0; j <= 20; ++j) {
+            x2.back().push_back(x1.back() + j * (10. - x1.back()) / 20.);
+            y.back().push_back(f(x1.back(), x2.back().back()));
+        }
+    }
+
+    auto table = TabulatedCubic2D(x1, x2, y);
+    for (double a = 0.; a <= 4.5; a += 0.17)
+        for (double u = 0.; u <= 1.; u += 0.1)
+            EXPECT_NEAR(table(a, a + u * (10. - a)), f(a, a + u * (10. - a)), 1e-8);
+}
+
 int main(int argc, char** argv)
 {
     ::testing::InitGoogleTest(&argc, argv);
@@ -100,6 +100,25 @@ TEST(SampleFromGaussian, Inf){
     EXPECT_DOUBLE_EQ(mean, sampled);
 }
 
+TEST(SampleFromTruncatedGaussian, CompareSampleFromGaussian){
+    // the tabulated percent point function should reproduce the exact
+    // sampling, with and without effective limits
+    RandomGenerator::Get().SetSeed(24601);
+    double sigma = 2;
+    double mean = 5;
+    for (int n = 0; n < 10000; n++) {
+        double rnd = RandomGenerator::Get().RandomDouble();
+        EXPECT_NEAR(SampleFromTruncatedGaussian(mean, sigma, rnd, -INF, INF),
+                    SampleFromGaussian(mean, sigma, rnd), 1e-6 * sigma);
+        auto truncated = SampleFromTruncatedGaussian(mean, sigma, rnd, 4, 7);
+        EXPECT_NEAR(truncated, SampleFromGaussian(mean, sigma, rnd, 4, 7),
+                    1e-6 * sigma);
+        EXPECT_GE(truncated, 4);
+        EXPECT_LE(truncated, 7);
+    }
+    EXPECT_DOUBLE_EQ(SampleFromTruncatedGaussian(mean, 0, 0.3, 4, 7), mean);
+}
+
 TEST(SampleFromExponential, Momenta){
     RandomGenerator::Get().SetSeed(24601);
     double lambda = 10;
@@ -174,7 +174,8 @@ TEST(Mupairproduction, Test_Calculate_Rho)
     ParticleDef particle_def = getParticleDef(particleName);
     std::shared_ptr<const Medium> medium = CreateMedium(mediumName);
 
-    auto fac = secondaries::KelnerKokoulinPetrukhinMupairProduction(particle_def, *medium);
+    // reference values are calculated by integration of the rho distribution
+    auto fac = secondaries::KelnerKokoulinPetrukhinMupairProduction(particle_def, *medium, false);
     rho = fac.CalculateRho(energy, v, medium->GetComponents().front(), rnd1, rnd2);
 
     E1_new = 0.5 * v * energy * (1 + rho);
@@ -185,6 +186,54 @@ TEST(Mupairproduction, Test_Calculate_Rho)
     }
 }
 
+TEST(Mupairproduction, Test_Calculate_Rho_Table)
+{
+    auto medium = Ice();
+    auto comp = medium.GetComponents().front();
+    auto table = secondaries::KelnerKokoulinPetrukhinMupairProduction(MuMinusDef(), medium);
+    auto integral = secondaries::KelnerKokoulinPetrukhinMupairProduction(MuMinusDef(), medium, false);
+
+    for (auto energy : {1e4, 1e6, 1e8, 1e10}) {
+        for (auto v : {0.05, 0.2, 0.5}) {
+            if (v * energy <= 4 * MMU)
+                continue;
+            // compare the quantiles of the rho distribution
+            for (auto rnd : {0.1, 0.3, 0.5, 0.7, 0.9}) {
+                auto rho_table = table.CalculateRho(energy, v, comp, rnd, 0.9);
+                auto rho_integral = integral.CalculateRho(energy, v, comp, rnd, 0.9);
+                EXPECT_NEAR(rho_table, rho_integral, 1e-2);
+            }
+        }
+    }
+}
+
+TEST(Mupairproduction, Test_Rho_Table_Quantiles)
+{
+    // the tabulated quantiles of rho are compared with the integrated ones
+    // at the stated accuracy, for the same random numbers, away from the
+    // kinematic limits of v
+    auto medium = Ice();
+    auto table = secondaries::KelnerKokoulinPetrukhinMupairProduction(MuMinusDef(), medium);
+    auto integral = secondaries::KelnerKokoulinPetrukhinMupairProduction(MuMinusDef(), medium, false);
+    auto param = crosssection::MupairKelnerKokoulinPetrukhin();
+
+    for (auto const& comp : medium.GetComponents()) {
+        for (auto log_energy = 3.5; log_energy <= 12; log_energy += 0.5) {
+            auto energy = std::pow(10., log_energy);
+            auto lim = param.GetKinematicLimits(MuMinusDef(), comp, energy);
+            for (auto x = 0.1; x < 0.95; x += 0.1) {
+                auto v = lim.v_min * std::pow(lim.v_max / lim.v_min, x);
+                for (auto rnd = 0.05; rnd < 1; rnd += 0.1) {
+                    auto rho_table = table.CalculateRho(energy, v, comp, rnd, 0.9);
+                    auto rho_integral = integral.CalculateRho(energy, v, comp, rnd, 0.9);
+                    EXPECT_NEAR(rho_table, rho_integral, 5e-3)
+                        << "energy: " << energy << ", v: " << v << ", rnd: " << rnd;
+                }
+            }
+        }
+    }
+}
+
 TEST(Mupairproduction, Test_of_dEdx_Interpolant)
 {
     std::ifstream in;
@@ -1,5 +1,6 @@
 #include "gtest/gtest.h"
 #include "PROPOSAL/crosssection/ParticleDefaultCrossSectionList.h"
+#include "PROPOSAL/BatchPropagator.h"
 #include "PROPOSAL/Propagator.h"
 #include "PROPOSAL/propagation_utility/TimeBuilder.h"
 #include "PROPOSAL/propagation_utility/InteractionBuilder.h"
@@ -8,6 +9,7 @@
 #include "PROPOSAL/scattering/ScatteringFactory.h"
 #include "PROPOSAL/geometry/Sphere.h"
 #include "PROPOSAL/particle/Particle.h"
+#include "PROPOSAL/math/RandomGenerator.h"
 
 using namespace PROPOSAL;
 
@@ -57,6 +59,117 @@ TEST(Propagator, min_energy)
     }
 }
 
+TEST(Propagator, sink_matches_secondaries)
+{
+    auto p_def = MuMinusDef();
+    auto medium = Ice();
+    auto cuts = std::make_shared<EnergyCutSettings>(INF, 0.05, false);
+    auto cross = GetStdCrossSections(p_def, medium, cuts, true);
+
+    auto collection = PropagationUtility::Collection();
+    collection.interaction_calc = make_interaction(cross, true);
+    collection.displacement_calc = make_displacement(cross, true);
+    collection.time_calc = make_time(cross, p_def, true);
+    collection.scattering = make_scattering(MultipleScatteringType::Highland, {}, p_def, medium);
+
+    auto prop_utility = PropagationUtility(collection);
+
+    auto density_distr = std::make_shared<Density_homogeneous>(medium);
+    auto world = std::make_shared<Sphere>(Cartesian3D(0, 0, 0), 1e20);
+
+    auto sector = std::make_tuple(world, prop_utility, density_distr);
+    std::vector<Sector> sec_vec = {sector};
+
+    auto prop = Propagator(p_def, sec_vec);
+
+    auto init_state = ParticleState();
+    init_state.energy = 1e6;
+    init_state.position = Cartesian3D(0, 0, 0);
+    init_state.direction = Cartesian3D(0, 0, 1);
+
+    for (size_t i=0; i<10; i++) {
+        RandomGenerator::Get().SetSeed(i);
+        auto sec = prop.Propagate(init_state, 1e5);
+
+        std::vector<ParticleState> states;
+        std::vector<InteractionType> types;
+        std::vector<size_t> hashes;
+        auto sink = [&](const ParticleState& state, InteractionType type,
+                        size_t hash) {
+            states.push_back(state);
+            types.push_back(type);
+            hashes.push_back(hash);
+        };
+        RandomGenerator::Get().SetSeed(i);
+        prop.Propagate(init_state, sink, 1e5);
+
+        EXPECT_EQ(sec.GetTrack(), states);
+        EXPECT_EQ(sec.GetTrackTypes(), types);
+        EXPECT_EQ(sec.GetTargetHashes(), hashes);
+    }
+}
+
+TEST(BatchPropagator, single_particle_matches_propagator)
+{
+    auto p_def = MuMinusDef();
+    auto medium = Ice();
+    auto cuts = std::make_shared<EnergyCutSettings>(INF, 0.05, true);
+    auto cross = GetStdCrossSections(p_def, medium, cuts, true);
+
+    auto collection = PropagationUtility::Collection();
+    collection.interaction_calc = make_interaction(cross, true);
+    collection.displacement_calc = make_displacement(cross, true);
+    collection.time_calc = make_time(cross, p_def, true);
+    collection.cont_rand = make_contrand(cross, true);
+    collection.scattering = make_scattering(MultipleScatteringType::Highland, {}, p_def, medium);
+
+    auto prop_utility = PropagationUtility(collection);
+
+    auto density_distr = std::make_shared<Density_homogeneous>(medium);
+    auto world = std::make_shared<Sphere>(Cartesian3D(0, 0, 0), 1e20);
+
+    auto sector = std::make_tuple(world, prop_utility, density_distr);
+    std::vector<Sector> sec_vec = {sector};
+
+    auto prop = Propagator(p_def, sec_vec);
+    auto batch_prop = BatchPropagator(prop);
+
+    auto init_state = ParticleState();
+    init_state.energy = 1e6;
+    init_state.position = Cartesian3D(0, 0, 0);
+    init_state.direction = Cartesian3D(0, 0, 1);
+
+    // with one particle, the random numbers are used in the same order
+    for (size_t i=0; i<10; i++) {
+        RandomGenerator::Get().SetSeed(i);
+        auto sec = prop.Propagate(init_state, 1e5, 1e3);
+        RandomGenerator::Get().SetSeed(i);
+        auto batch = batch_prop.Propagate({init_state}, 1e5, 1e3);
+
+        ASSERT_EQ(batch.size(), 1u);
+        EXPECT_EQ(batch[0].GetTrack(), sec.GetTrack());
+        EXPECT_EQ(batch[0].GetTrackTypes(), sec.GetTrackTypes());
+    }
+
+    // every track belongs to its initial particle and fulfills the
+    // propagation conditions
+    std::vector<ParticleState> init_states;
+    for (size_t i=0; i<100; i++) {
+        init_states.push_back(init_state);
+        init_states.back().energy = 1e4 * (i + 1);
+    }
+    auto tracks = batch_prop.Propagate(init_states, 1e5, 1e3);
+    ASSERT_EQ(tracks.size(), init_states.size());
+    for (size_t i=0; i<tracks.size(); i++) {
+        EXPECT_EQ(tracks[i].GetInitialState(), init_states[i]);
+        auto final_state = tracks[i].GetFinalState();
+        EXPECT_LE(final_state.propagated_distance, 1e5);
+        if (final_state.propagated_distance < 1e5
+            && tracks[i].GetTrackTypes().back() != InteractionType::Decay)
+            EXPECT_LE(final_state.energy, 1e3);
+    }
+}
+
 int main(int argc, char** argv)
 {
     ::testing::InitGoogleTest(&argc, argv);
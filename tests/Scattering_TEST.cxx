@@ -3,6 +3,7 @@
 
 #include "gtest/gtest.h"
 
+#include "PROPOSAL/math/MathMethods.h"
 #include "PROPOSAL/math/RandomGenerator.h"
 #include "PROPOSAL/medium/Medium.h"
 #include "PROPOSAL/medium/MediumFactory.h"
@@ -209,6 +210,28 @@ TEST(Scattering, BorderCases){
     }
 }
 
+TEST(Scattering, MoliereTable){
+    // angles sampled from the table agree with the inversion by Newton's method
+    RandomGenerator::Get().SetSeed(24601);
+    for (auto const& medium : std::vector<Medium>{Water(), StandardRock()}) {
+        multiple_scattering::Moliere table(MuMinusDef(), medium);
+        multiple_scattering::Moliere newton(MuMinusDef(), medium, false);
+
+        for (int n = 0; n < 1e3; ++n) {
+            auto grammage = std::pow(10., -2 + 7 * RandomGenerator::Get().RandomDouble());
+            auto energy = std::pow(10., 3 + 8 * RandomGenerator::Get().RandomDouble());
+            std::array<double, 4> rnd = {RandomGenerator::Get().RandomDouble(), RandomGenerator::Get().RandomDouble(),
+                                         RandomGenerator::Get().RandomDouble(), RandomGenerator::Get().RandomDouble()};
+            auto expected = newton.CalculateRandomAngle(grammage, energy, energy, rnd);
+            auto offset = table.CalculateRandomAngle(grammage, energy, energy, rnd);
+            EXPECT_NEAR(offset.tx, expected.tx, 3e-3 * std::abs(expected.tx));
+            EXPECT_NEAR(offset.ty, expected.ty, 3e-3 * std::abs(expected.ty));
+            EXPECT_NEAR(offset.sx, expected.sx, 3e-3 * (std::abs(expected.tx) + std::abs(expected.sx)));
+            EXPECT_NEAR(offset.sy, expected.sy, 3e-3 * (std::abs(expected.ty) + std::abs(expected.sy)));
+        }
+    }
+}
+
 TEST(Scattering, ZeroDisplacement){
     // No displacement should mean no scattering
     auto medium = StandardRock();
@@ -364,6 +387,47 @@ TEST(Scattering, compare_integral_interpolant) {
     }
 }
 
+TEST(Scattering, HighlandBatch) {
+    // a bundle of steps gives the same angles as the single steps
+    RandomGenerator::Get().SetSeed(24601);
+    auto medium = StandardRock();
+    auto cut = std::make_shared<EnergyCutSettings>(INF, 1, false);
+    auto cross = GetCrossSections(MuMinusDef(), medium, cut, true);
+
+    std::vector<std::unique_ptr<multiple_scattering::Highland>> scatter_list;
+    scatter_list.emplace_back(new multiple_scattering::Highland(MuMinusDef(), medium));
+    scatter_list.emplace_back(new multiple_scattering::HighlandIntegral(MuMinusDef(), medium,
+            make_displacement(cross, false), std::true_type{}));
+
+    std::vector<double> grammage, e_i, e_f;
+    std::vector<std::array<double, 4>> rnd;
+    for (int n = 0; n < 100; ++n) {
+        e_i.push_back(std::pow(10., 3 + 8 * RandomGenerator::Get().RandomDouble()));
+        e_f.push_back(e_i.back() * (n % 10 == 0 ? 1 - 1e-8 : RandomGenerator::Get().RandomDouble()));
+        grammage.push_back(std::pow(10., 5 * RandomGenerator::Get().RandomDouble()));
+        rnd.push_back({RandomGenerator::Get().RandomDouble(), RandomGenerator::Get().RandomDouble(),
+                       RandomGenerator::Get().RandomDouble(), RandomGenerator::Get().RandomDouble()});
+    }
+    e_f[1] = 1e3;
+
+    for (auto const& scatter : scatter_list) {
+        std::vector<double> theta0;
+        scatter->CalculateTheta0(grammage, e_i, e_f, theta0);
+        auto offsets = scatter->CalculateRandomAngle(grammage, e_i, e_f, rnd);
+        ASSERT_EQ(theta0.size(), grammage.size());
+        ASSERT_EQ(offsets.size(), grammage.size());
+        for (size_t i = 0; i < grammage.size(); ++i) {
+            EXPECT_EQ(theta0[i], scatter->CalculateTheta0(grammage[i], e_i[i], e_f[i]));
+            EXPECT_GT(theta0[i], 0);
+            auto offset = scatter->CalculateRandomAngle(grammage[i], e_i[i], e_f[i], rnd[i]);
+            EXPECT_EQ(offsets[i].sx, offset.sx);
+            EXPECT_EQ(offsets[i].sy, offset.sy);
+            EXPECT_EQ(offsets[i].tx, offset.tx);
+            EXPECT_EQ(offsets[i].ty, offset.ty);
+        }
+    }
+}
+
 TEST(Scattering, ScatterReproducibilityTest)
 {
     std::ifstream in;
@@ -497,6 +561,79 @@ TEST(Scattering, NoScattering)
     EXPECT_EQ(std::get<1>(new_dir), init_dir);
 }
 
+TEST(Scattering, StochasticDeflection)
+{
+    nlohmann::json config;
+    config["stochastic_deflection"] = { "BremsTsaiApproximation", "IonizNaive" };
+
+    auto cross_dummy = GetStdCrossSections(
+            MuMinusDef(), StandardRock(),
+            std::make_shared<EnergyCutSettings>(500, 0.05, false), false);
+    auto scattering = make_scattering(config, MuMinusDef(), StandardRock(),
+                                      cross_dummy, false);
+
+    EXPECT_EQ(scattering->StochasticDeflectionRandomNumbers(InteractionType::Brems), 2);
+    EXPECT_EQ(scattering->StochasticDeflectionRandomNumbers(InteractionType::Ioniz), 1);
+    EXPECT_EQ(scattering->StochasticDeflectionRandomNumbers(InteractionType::Epair), 0);
+    EXPECT_EQ(scattering->StochasticDeflectionRandomNumbers(InteractionType::Undefined), 0);
+
+    PropagationUtility::Collection collection;
+    collection.interaction_calc = make_interaction(cross_dummy, false);
+    collection.displacement_calc = make_displacement(cross_dummy, false);
+    collection.time_calc = make_time(cross_dummy, MuMinusDef(), false);
+    collection.scattering = std::move(scattering);
+    PropagationUtility utility(collection);
+
+    // interaction types without deflection must not use random numbers
+    Cartesian3D init_dir(0, 0, 1);
+    auto rnd_throw = []()->double {
+        throw std::logic_error("No random numbers should be used here!");
+    };
+    auto new_dir = utility.DirectionDeflect(InteractionType::Epair, 1e6, 1e5,
+                                            init_dir, rnd_throw, 0);
+    EXPECT_EQ(new_dir, init_dir);
+
+    auto n_calls = 0;
+    auto rnd_count = [&n_calls]()->double {
+        ++n_calls;
+        return 0.5;
+    };
+    new_dir = utility.DirectionDeflect(InteractionType::Brems, 1e6, 1e5,
+                                       init_dir, rnd_count, 0);
+    EXPECT_EQ(n_calls, 2);
+    EXPECT_NEAR(new_dir.magnitude(), 1., 1e-12);
+    EXPECT_LT(new_dir.GetZ(), 1.);
+}
+
+TEST(Scattering, BremsGinnekenTable)
+{
+    // compare the tabulated rms angle with the parametrization for nu < 0.5
+    auto medium = StandardRock();
+    auto component = medium.GetComponents().front();
+    auto Z = component.GetNucCharge();
+    stochastic_deflection::BremsGinneken deflection(MuMinusDef(), medium);
+
+    auto rnd = stochastic_deflection::RandomNumbers{ 0.5, 0.25 };
+    auto muon_mass = MMU / 1000.;
+    for (auto e_i : { 1., 13.7, 420., 1e4, 3.3e6 }) {
+        for (auto nu : { 1e-5, 3e-3, 0.07, 0.3, 0.49 }) {
+            auto e_f = e_i - nu * (e_i - muon_mass);
+            auto k_1 = 0.092 * std::pow(e_i, -1.0 / 3.0);
+            auto k_2 = 0.052 / e_i * std::pow(Z, -0.25);
+            auto k_3 = 0.22 * std::pow(e_i, -0.92);
+            auto rms_theta
+                = std::max(std::min(k_1 * std::sqrt(nu), k_2), k_3 * nu);
+            auto theta = std::sqrt(SampleFromExponential(
+                rnd[0], 1. / (rms_theta * rms_theta)));
+
+            auto angles = deflection.CalculateStochasticDeflection(
+                e_i * 1000., e_f * 1000., rnd, component.GetHash());
+            EXPECT_NEAR(angles.zenith, theta, 2e-2 * theta);
+            EXPECT_DOUBLE_EQ(angles.azimuth, 2 * PI * rnd[1]);
+        }
+    }
+}
+
 int main(int argc, char** argv)
 {
     ::testing::InitGoogleTest(&argc, argv);
@@ -338,6 +338,43 @@ TEST(SecondaryVector, EnergyConservation) {
     EXPECT_DOUBLE_EQ(sum_continuous_losses + sum_stochastic_losses + MuMinusDef().mass, energy);
 }
 
+TEST(SecondaryVector, TrackColumns) {
+    auto prop = GetPropagatorStochastic();
+
+    Cartesian3D position(0, 0, 0);
+    Cartesian3D direction(0, 0, 1);
+    auto init_state = ParticleState(position, direction, 1e6, 0., 0.);
+
+    auto secondaries = prop->Propagate(init_state);
+    auto track = secondaries.GetTrack();
+
+    auto& energies = secondaries.GetTrackEnergies();
+    auto& times = secondaries.GetTrackTimes();
+    auto& distances = secondaries.GetTrackPropagatedDistances();
+    auto& positions = secondaries.GetTrackPositionCoordinates();
+    auto& directions = secondaries.GetTrackDirectionCoordinates();
+
+    ASSERT_EQ(track.size(), secondaries.GetTrackLength());
+    ASSERT_EQ(energies.size(), track.size());
+    for (size_t i = 0; i < track.size(); i++) {
+        EXPECT_EQ(energies[i], track[i].energy);
+        EXPECT_EQ(times[i], track[i].time);
+        EXPECT_EQ(distances[i], track[i].propagated_distance);
+        EXPECT_EQ(Cartesian3D(positions[i]), track[i].position);
+        EXPECT_EQ(Cartesian3D(directions[i]), track[i].direction);
+        EXPECT_EQ(secondaries[i], track[i]);
+    }
+
+    // accessors return references to the stored arrays
+    EXPECT_EQ(energies.data(), secondaries.GetTrackEnergies().data());
+
+    auto n_losses = 0u;
+    for (auto type : secondaries.GetTrackTypes())
+        if (type == InteractionType::Epair)
+            n_losses++;
+    EXPECT_EQ(n_losses, secondaries.GetStochasticLosses(InteractionType::Epair).size());
+}
+
 int main(int argc, char** argv)
 {
     ::testing::InitGoogleTest(&argc, argv);
@@ -2,12 +2,14 @@
 #include <cmath>
 
 #include "PROPOSAL/secondaries/parametrization/compton/NaivCompton.h"
+#include "PROPOSAL/secondaries/parametrization/epairproduction/KelnerKokoulinPetrukhinEpairProduction.h"
 #include "PROPOSAL/secondaries/parametrization/ionization/NaivIonization.h"
 #include "PROPOSAL/secondaries/parametrization/photomupairproduction/PhotoMuPairProductionBurkhardtKelnerKokoulin.h"
 #include "PROPOSAL/secondaries/parametrization/photopairproduction/PhotoPairProductionKochMotz.h"
 #include "PROPOSAL/secondaries/parametrization/photopairproduction/PhotoPairProductionTsai.h"
 #include "PROPOSAL/secondaries/parametrization/annihilation/HeitlerAnnihilation.h"
 #include "PROPOSAL/secondaries/parametrization/photoeffect/PhotoeffectNoDeflection.h"
+#include "PROPOSAL/crosssection/parametrization/EpairProduction.h"
 #include "PROPOSAL/crosssection/parametrization/Photoeffect.h"
 #include "PROPOSAL/crosssection/CrossSectionBuilder.h"
 #include "PROPOSAL/Constants.h"
@@ -51,6 +53,7 @@ auto GetPhotoPairProductionParamList(ParticleDef particle, Medium medium) {
     param_list.push_back(std::make_unique<secondaries::PhotoPairProductionKochMotzForwardPeaked>(particle, medium));
     param_list.push_back(std::make_unique<secondaries::PhotoPairProductionTsaiForwardPeaked>(particle, medium));
     param_list.push_back(std::make_unique<secondaries::PhotoPairProductionTsai>(particle, medium));
+    param_list.push_back(std::make_unique<secondaries::PhotoPairProductionTsai>(particle, medium, false));
     return param_list;
 }
 
@@ -250,6 +253,67 @@ TEST(Compton, EnergyMomentumConservation)
         EXPECT_NEAR(p_init[i], p_photon[i] + p_electron[i], COMPUTER_PRECISION);
 }
 
+TEST(EpairProduction, RhoTable)
+{
+    // the tabulated quantiles of rho are compared with the integrated ones
+    // at the stated accuracy, for the same random numbers, away from the
+    // kinematic limits of v
+    auto medium = Ice();
+    auto table = secondaries::KelnerKokoulinPetrukhinEpairProduction(MuMinusDef(), medium);
+    auto integral = secondaries::KelnerKokoulinPetrukhinEpairProduction(MuMinusDef(), medium, false);
+    auto param = crosssection::EpairKelnerKokoulinPetrukhin(false);
+
+    for (auto const& comp : medium.GetComponents()) {
+        for (auto log_energy = 3.5; log_energy <= 12; log_energy += 0.5) {
+            auto energy = std::pow(10., log_energy);
+            auto lim = param.GetKinematicLimits(MuMinusDef(), comp, energy);
+            for (auto x = 0.1; x < 0.95; x += 0.1) {
+                auto v = lim.v_min * std::pow(lim.v_max / lim.v_min, x);
+                for (auto rnd = 0.05; rnd < 1; rnd += 0.1) {
+                    auto rho_table = table.CalculateRho(energy, v, comp, rnd, 0.9);
+                    auto rho_integral = integral.CalculateRho(energy, v, comp, rnd, 0.9);
+                    EXPECT_GE(rho_table, 0.);
+                    EXPECT_LE(rho_table, 1.);
+                    EXPECT_NEAR(rho_table, rho_integral, 5e-3)
+                        << "energy: " << energy << ", v: " << v << ", rnd: " << rnd;
+                }
+            }
+        }
+    }
+}
+
+TEST(PhotoPairProductionTsai, ThetaTable)
+{
+    // the substituted polar angles of the tabulated and the integrated
+    // sampling are compared for the same random numbers. Above 100 GeV the
+    // angles are too small to be resolved by the direction.
+    auto medium = Ice();
+    auto table = secondaries::PhotoPairProductionTsai(GammaDef(), medium);
+    auto integral = secondaries::PhotoPairProductionTsai(GammaDef(), medium, false);
+    auto direction = Cartesian3D(0, 0, 1);
+
+    for (auto const& comp : medium.GetComponents()) {
+        for (auto log_energy = 1.5; log_energy <= 5; log_energy += 0.5) {
+            auto energy = std::pow(10., log_energy);
+            auto subst = std::max(1., log_energy);
+            auto x_min = ME / energy;
+            for (auto x = 0.1; x < 0.95; x += 0.1) {
+                auto energy_fraction = x_min + (1 - 2 * x_min) * x;
+                for (auto rnd = 0.05; rnd < 1; rnd += 0.1) {
+                    auto dir_table = std::get<0>(table.CalculateDirections(
+                        direction, energy, energy_fraction, comp, rnd, 0.5, 0.3));
+                    auto dir_integral = std::get<0>(integral.CalculateDirections(
+                        direction, energy, energy_fraction, comp, rnd, 0.5, 0.3));
+                    auto t_table = std::pow(std::acos(dir_table.GetZ()) / PI, 1 / subst);
+                    auto t_integral = std::pow(std::acos(dir_integral.GetZ()) / PI, 1 / subst);
+                    EXPECT_NEAR(t_table, t_integral, 5e-3)
+                        << "energy: " << energy << ", x: " << energy_fraction << ", rnd: " << rnd;
+                }
+            }
+        }
+    }
+}
+
 int main(int argc, char** argv)
 {
     ::testing::InitGoogleTest(&argc, argv);
@@ -49,6 +49,44 @@ TEST(Cubic_Spline, Comparison_equal) {
     }
 }
 
+TEST(Cubic_Spline, SegmentLookup) {
+    std::vector<double> x(1000);
+    std::vector<double> f_x(x.size());
+    for (unsigned long i = 0; i < x.size(); ++i) {
+        x[i] = 0.01 * i;
+        f_x[i] = std::sin(x[i]);
+    }
+    Cubic_Spline sp(x, f_x);
+    auto splines = sp.GetFunctions();
+
+    unsigned int segment = 0;
+    for (double val = -0.5; val < 10.5; val += 0.0037) {
+        unsigned int i = 0;
+        while (i + 1 < splines.size() && x[i + 1] < val)
+            ++i;
+        auto expected = splines[i].evaluate(val);
+        ASSERT_NEAR(sp.evaluate(val), expected, 1e-12);
+        ASSERT_NEAR(sp.evaluate_with_hint(val, segment), expected, 1e-12);
+        ASSERT_NEAR(sp.evaluate_with_hint(10. - val, segment),
+            sp.evaluate(10. - val), 1e-12);
+    }
+}
+
+TEST(Linear_Spline, Derivative) {
+    std::vector<double> x(10);
+    std::vector<double> f_x(10);
+    std::iota(std::begin(x), std::end(x), 0);
+
+    for (unsigned long i = 0; i < x.size(); ++i) {
+        f_x[i] = 2 * x[i] + 1;
+    }
+    Linear_Spline sp(x, f_x);
+    sp.Derivative();
+    for (double val = 0.; val < 9.; val += 0.5) {
+        ASSERT_NEAR(sp.evaluate(val), 2., 1e-12);
+    }
+}
+
 int main(int argc, char** argv) {
     ::testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();
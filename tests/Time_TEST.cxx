@@ -167,6 +167,69 @@ TEST(ExactTimeBuilder, CompareIntegralInterpolant)
     }
 }
 
+TEST(ExactTimeBuilder, GrammageAndTimeElapsed)
+{
+    // grammage and time of the joint lookup should agree with the integrals
+    // and the vectorized form with the scalar one
+    auto cross = GetCrossSections(true);
+    auto medium = Ice();
+
+    auto displacement = make_displacement(cross, false);
+    auto time_integral = make_time(cross, MuMinusDef(), false);
+    auto time_interpolant = make_time(cross, MuMinusDef(), true);
+
+    std::vector<double> E_i, E_f;
+    for (double Elog_i = 3.5; Elog_i < 12.; Elog_i += 0.1) {
+        E_i.push_back(std::pow(10., Elog_i));
+        E_f.push_back(E_i.back() * 0.1);
+    }
+    auto density = std::vector<double>(E_i.size(), medium.GetMassDensity());
+
+    std::vector<double> grammage, time;
+    time_interpolant->GrammageAndTimeElapsed(
+        *displacement, E_i, E_f, density, grammage, time);
+    ASSERT_EQ(grammage.size(), E_i.size());
+    ASSERT_EQ(time.size(), E_i.size());
+
+    for (size_t i = 0; i < E_i.size(); ++i) {
+        auto integrated_grammage
+            = displacement->SolveTrackIntegral(E_i[i], E_f[i]);
+        auto integrated_time = time_integral->TimeElapsed(
+            E_i[i], E_f[i], integrated_grammage, density[i]);
+        auto joint = time_interpolant->GrammageAndTimeElapsed(
+            *displacement, E_i[i], E_f[i], density[i]);
+        EXPECT_NEAR(joint.first, integrated_grammage, integrated_grammage * 1e-4);
+        EXPECT_NEAR(joint.second, integrated_time, integrated_time * 1e-4);
+        EXPECT_DOUBLE_EQ(grammage[i], joint.first);
+        EXPECT_DOUBLE_EQ(time[i], joint.second);
+    }
+}
+
+TEST(ExactTimeBuilder, GrammageAndTimeElapsedShortStep)
+{
+    // steps too short for an integration are given by the integrands
+    auto cross = GetCrossSections(true);
+    auto medium = Ice();
+
+    auto displacement = make_displacement(cross, false);
+    auto time_integral = ExactTimeBuilder(
+        std::shared_ptr<Displacement>(make_displacement(cross, false)),
+        MuMinusDef().mass, std::false_type {});
+    auto time_interpolant = make_time(cross, MuMinusDef(), true);
+
+    for (double Elog_i = 3.; Elog_i < 12.; Elog_i += 0.1) {
+        auto E_i = std::pow(10., Elog_i);
+        auto E_f = E_i * (1. - 1e-9);
+        auto grammage = -displacement->FunctionToIntegral(E_i) * (E_i - E_f);
+        auto time = -time_integral.FunctionToIntegral(E_i) * (E_i - E_f)
+            / medium.GetMassDensity();
+        auto joint = time_interpolant->GrammageAndTimeElapsed(
+            *displacement, E_i, E_f, medium.GetMassDensity());
+        EXPECT_NEAR(joint.first, grammage, grammage * 1e-4);
+        EXPECT_NEAR(joint.second, time, time * 1e-4);
+    }
+}
+
 int main(int argc, char** argv)
 {
     ::testing::InitGoogleTest(&argc, argv);
@@ -3,11 +3,13 @@
 #include <iostream>
 #include <PROPOSAL/math/Cartesian3D.h>
 #include <PROPOSAL/math/Spherical3D.h>
+#include <PROPOSAL/math/Vec3.h>
 
 #include "gtest/gtest.h"
 
 #include "PROPOSAL/math/Vector3D.h"
 #include "PROPOSAL/Constants.h"
+#include "PROPOSAL/math/RandomGenerator.h"
 
 using namespace PROPOSAL;
 
@@ -306,6 +308,46 @@ TEST(Deflection, Deflection)
     }
 }
 
+TEST(Deflection, Vec3_orthonormal_basis)
+{
+    // rotation basis without trigonometric functions has to be a right-handed
+    // orthonormal basis for all directions, including the poles
+    std::vector<Cartesian3D> directions{ Cartesian3D(1., 0., 0.),
+        Cartesian3D(0., -1. / SQRT2, 1. / SQRT2),
+        Cartesian3D(1. / 3., 2. / 3., -2. / 3.),
+        Cartesian3D(-0.48, -0.6, 0.64), Cartesian3D(0., 0., 1.),
+        Cartesian3D(0., 0., -1.), Cartesian3D(1e-9, -2e-9, -1.) };
+    for (int i = 0; i < 100; ++i)
+        directions.emplace_back(Spherical3D(1., 2. * PI * RandomGenerator::Get().RandomDouble(),
+            PI * RandomGenerator::Get().RandomDouble()));
+
+    for (auto& dir : directions) {
+        dir.normalize();
+        auto basis = Vec3(dir).GetOrthonormalBasis();
+        EXPECT_NEAR(basis.first * basis.first, 1., 1e-12);
+        EXPECT_NEAR(basis.second * basis.second, 1., 1e-12);
+        EXPECT_NEAR(basis.first * basis.second, 0., 1e-12);
+        EXPECT_NEAR(basis.first * Vec3(dir), 0., 1e-12);
+        EXPECT_NEAR(basis.second * Vec3(dir), 0., 1e-12);
+        auto normal = vector_product(basis.first, basis.second);
+        EXPECT_NEAR(normal.x, dir.GetX(), 1e-12);
+        EXPECT_NEAR(normal.y, dir.GetY(), 1e-12);
+        EXPECT_NEAR(normal.z, dir.GetZ(), 1e-12);
+
+        auto vec = Vec3(dir);
+        vec.deflect(0.3, PI / 3.);
+        auto cartesian = Cartesian3D(dir);
+        cartesian.deflect(0.3, PI / 3.);
+        EXPECT_EQ(Cartesian3D(vec), cartesian);
+        EXPECT_NEAR(vec * Vec3(dir), 0.3, 1e-12);
+        EXPECT_NEAR(vec.magnitude(), 1., 1e-12);
+    }
+
+    auto basis = Vec3(0., 0., 1.).GetOrthonormalBasis();
+    EXPECT_EQ(Cartesian3D(basis.first), Cartesian3D(1., 0., 0.));
+    EXPECT_EQ(Cartesian3D(basis.second), Cartesian3D(0., 1., 0.));
+}
+
 int main(int argc, char** argv)
 {
     ::testing::InitGoogleTest(&argc, argv);